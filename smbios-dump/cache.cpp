@@ -0,0 +1,270 @@
+#include "cache.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+
+#include <q-tee/common/common.h>
+
+#if defined(Q_OS_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// header of the entry file, that is followed by the output itself
+struct CacheEntryHeader_t
+{
+	char arrMagic[8];
+	std::uint64_t ullTablesHash;
+	std::uint64_t ullOutputSize;
+	std::uint64_t ullOutputHash;
+};
+
+constexpr char arrEntryMagic[8] = { 'S', 'M', 'B', 'D', 'C', 'A', 'C', 'H' };
+
+constexpr std::uint64_t ullPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t ullPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t ullPrime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t ullPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t ullPrime5 = 0x27D4EB2F165667C5ULL;
+
+static std::uint64_t RotateLeft(const std::uint64_t ullValue, const int nCount)
+{
+	return (ullValue << nCount) | (ullValue >> (64 - nCount));
+}
+
+static std::uint64_t HashRound(std::uint64_t ullAccumulator, const std::uint64_t ullInput)
+{
+	ullAccumulator += ullInput * ullPrime2;
+	return RotateLeft(ullAccumulator, 31) * ullPrime1;
+}
+
+static std::uint64_t HashMergeRound(const std::uint64_t ullAccumulator, const std::uint64_t ullValue)
+{
+	return (ullAccumulator ^ HashRound(0ULL, ullValue)) * ullPrime1 + ullPrime4;
+}
+
+// read the value in the native byte order, the hash is only compared on the same machine
+template <typename T>
+static T ReadUnaligned(const std::uint8_t* pData)
+{
+	T value;
+	std::memcpy(&value, pData, sizeof(T));
+	return value;
+}
+
+std::uint64_t HashData(const void* pData, const std::size_t nDataSize, const std::uint64_t ullSeed)
+{
+	const auto pCurrent = static_cast<const std::uint8_t*>(pData);
+	const std::uint8_t* pEnd = pCurrent + nDataSize;
+	const std::uint8_t* pByte = pCurrent;
+
+	std::uint64_t ullHash;
+	if (nDataSize >= 32U)
+	{
+		// four independent lanes of 32 bytes stripes
+		std::uint64_t arrLanes[4] = { ullSeed + ullPrime1 + ullPrime2, ullSeed + ullPrime2, ullSeed, ullSeed - ullPrime1 };
+		for (; pEnd - pByte >= 32; pByte += 32)
+		{
+			for (std::size_t i = 0U; i < 4U; ++i)
+				arrLanes[i] = HashRound(arrLanes[i], ReadUnaligned<std::uint64_t>(pByte + i * 8U));
+		}
+
+		ullHash = RotateLeft(arrLanes[0], 1) + RotateLeft(arrLanes[1], 7) + RotateLeft(arrLanes[2], 12) + RotateLeft(arrLanes[3], 18);
+		for (const std::uint64_t ullLane : arrLanes)
+			ullHash = HashMergeRound(ullHash, ullLane);
+	}
+	else
+		ullHash = ullSeed + ullPrime5;
+
+	ullHash += static_cast<std::uint64_t>(nDataSize);
+
+	for (; pEnd - pByte >= 8; pByte += 8)
+		ullHash = RotateLeft(ullHash ^ HashRound(0ULL, ReadUnaligned<std::uint64_t>(pByte)), 27) * ullPrime1 + ullPrime4;
+
+	if (pEnd - pByte >= 4)
+	{
+		ullHash = RotateLeft(ullHash ^ (static_cast<std::uint64_t>(ReadUnaligned<std::uint32_t>(pByte)) * ullPrime1), 23) * ullPrime2 + ullPrime3;
+		pByte += 4;
+	}
+
+	for (; pByte < pEnd; ++pByte)
+		ullHash = RotateLeft(ullHash ^ (*pByte * ullPrime5), 11) * ullPrime1;
+
+	ullHash ^= ullHash >> 33U;
+	ullHash *= ullPrime2;
+	ullHash ^= ullHash >> 29U;
+	ullHash *= ullPrime3;
+	ullHash ^= ullHash >> 32U;
+	return ullHash;
+}
+
+/*
+ * hash the contents of the running executable, so the entries of the other builds, whose output or entries layout may differ, are never used
+ * @returns: true if the whole executable has been hashed, false otherwise
+ */
+static bool HashExecutable(std::uint64_t* pullHash)
+{
+#if defined(Q_OS_WINDOWS)
+	char szExecutablePath[MAX_PATH];
+	const DWORD nPathLength = ::GetModuleFileNameA(nullptr, szExecutablePath, sizeof(szExecutablePath));
+	if (nPathLength == 0U || nPathLength >= sizeof(szExecutablePath))
+		return false;
+#else
+	const char* szExecutablePath = "/proc/self/exe";
+#endif
+
+	FILE* hFile = std::fopen(szExecutablePath, "rb");
+	if (hFile == nullptr)
+		return false;
+
+	// hash is chained over the chunks, so the executable isn't held in memory at once
+	constexpr std::size_t nChunkSize = 256U * 1024U;
+	const std::unique_ptr<std::uint8_t[]> pChunk(new std::uint8_t[nChunkSize]);
+	std::uint64_t ullHash = 0ULL;
+	std::size_t nReadSize = 0U;
+	while ((nReadSize = std::fread(pChunk.get(), 1U, nChunkSize, hFile)) > 0U)
+		ullHash = HashData(pChunk.get(), nReadSize, ullHash);
+
+	const bool bSucceeded = (std::ferror(hFile) == 0);
+	std::fclose(hFile);
+
+	*pullHash = ullHash;
+	return bSucceeded;
+}
+
+/*
+ * write the whole file to the temporary file in the same directory, and then rename it over the target
+ * @returns: true if file has been replaced, false otherwise
+ */
+static bool ReplaceFile(const std::string& strFilePath, const void* pHeader, const std::size_t nHeaderSize, const void* pData, const std::size_t nDataSize)
+{
+	char szSuffix[32];
+#if defined(Q_OS_WINDOWS)
+	std::snprintf(szSuffix, sizeof(szSuffix), ".tmp");
+#else
+	std::snprintf(szSuffix, sizeof(szSuffix), ".tmp.%ld", static_cast<long>(::getpid()));
+#endif
+	const std::string strTemporaryPath = strFilePath + szSuffix;
+
+	FILE* hFile = std::fopen(strTemporaryPath.c_str(), "wb");
+	if (hFile == nullptr)
+		return false;
+
+	bool bSucceeded = (std::fwrite(pHeader, 1U, nHeaderSize, hFile) == nHeaderSize && (nDataSize == 0U || std::fwrite(pData, 1U, nDataSize, hFile) == nDataSize));
+	bSucceeded = (std::fclose(hFile) == 0 && bSucceeded);
+
+	std::error_code errorCode;
+	if (bSucceeded)
+		std::filesystem::rename(strTemporaryPath, strFilePath, errorCode);
+
+	if (!bSucceeded || errorCode)
+	{
+		std::filesystem::remove(strTemporaryPath, errorCode);
+		return false;
+	}
+
+	return true;
+}
+
+COutputCache::COutputCache(const char* szDirectoryPath, const DecodeOptions_t& options) :
+	strDirectoryPath(szDirectoryPath)
+{
+	// cache is disabled, rather than shared with the other builds, when the executable can't be read
+	std::uint64_t ullKey = 0ULL;
+	if (!HashExecutable(&ullKey))
+		return;
+
+	// only the options, that change the output, are the part of the key
+	ullKey = HashData(&options.nFormat, sizeof(options.nFormat), ullKey);
+	ullKey = HashData(&options.bResolveHandles, sizeof(options.bResolveHandles), ullKey);
+	if (options.bFilterTypes)
+		ullKey = HashData(options.arrTypeFilter, sizeof(options.arrTypeFilter), ullKey);
+
+	char szEntryName[32];
+	std::snprintf(szEntryName, sizeof(szEntryName), "%016" PRIx64 ".cache", ullKey);
+	strEntryPath = (std::filesystem::path(strDirectoryPath) / szEntryName).string();
+}
+
+void COutputCache::SetTables(const std::uint8_t* pFirstData, const std::size_t nFirstSize, const std::uint8_t* pSecondData, const std::size_t nSecondSize, const std::uint32_t uVersion)
+{
+	ullTablesHash = HashData(&uVersion, sizeof(uVersion), 0ULL);
+	ullTablesHash = HashData(pFirstData, nFirstSize, ullTablesHash);
+	if (pSecondData != nullptr)
+		ullTablesHash = HashData(pSecondData, nSecondSize, ullTablesHash);
+}
+
+bool COutputCache::Load(COutput& output) const
+{
+	FILE* hFile = std::fopen(strEntryPath.c_str(), "rb");
+	if (hFile == nullptr)
+		return false;
+
+	CacheEntryHeader_t header = { };
+	bool bValid = (std::fread(&header, sizeof(header), 1U, hFile) == 1U && std::memcmp(header.arrMagic, arrEntryMagic, sizeof(arrEntryMagic)) == 0 && header.ullTablesHash == ullTablesHash);
+
+	// output of the decoded table is small, so it's read at once to be validated before any of it is written
+	std::unique_ptr<char[]> pOutputData;
+	if (bValid)
+	{
+		pOutputData.reset(new char[header.ullOutputSize > 0U ? header.ullOutputSize : 1U]);
+		bValid = (std::fread(pOutputData.get(), 1U, header.ullOutputSize, hFile) == header.ullOutputSize && HashData(pOutputData.get(), header.ullOutputSize, 0ULL) == header.ullOutputHash);
+	}
+
+	std::fclose(hFile);
+
+	if (bValid)
+		output.Append(COutput::String_t{ pOutputData.get(), static_cast<std::size_t>(header.ullOutputSize) });
+
+	return bValid;
+}
+
+bool COutputCache::Store(const char* pOutputData, const std::size_t nOutputSize) const
+{
+	std::error_code errorCode;
+	std::filesystem::create_directories(strDirectoryPath, errorCode);
+	if (errorCode)
+		return false;
+
+	CacheEntryHeader_t header = { };
+	std::memcpy(header.arrMagic, arrEntryMagic, sizeof(arrEntryMagic));
+	header.ullTablesHash = ullTablesHash;
+	header.ullOutputSize = nOutputSize;
+	header.ullOutputHash = HashData(pOutputData, nOutputSize, 0ULL);
+
+	return ReplaceFile(strEntryPath, &header, sizeof(header), pOutputData, nOutputSize);
+}
+
+CacheStatistics_t COutputCache::CountLookup(const bool bHit) const
+{
+	const std::string strStatisticsPath = (std::filesystem::path(strDirectoryPath) / "statistics").string();
+
+	CacheStatistics_t statistics = { };
+	if (FILE* hFile = std::fopen(strStatisticsPath.c_str(), "r"); hFile != nullptr)
+	{
+		if (std::fscanf(hFile, "hits %" SCNu64 "\nmisses %" SCNu64, &statistics.ullHitCount, &statistics.ullMissCount) != 2)
+			statistics = { };
+
+		std::fclose(hFile);
+	}
+
+	if (bHit)
+		++statistics.ullHitCount;
+	else
+		++statistics.ullMissCount;
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(strDirectoryPath, errorCode);
+
+	char szStatistics[64];
+	const int nLength = std::snprintf(szStatistics, sizeof(szStatistics), "hits %" PRIu64 "\nmisses %" PRIu64 "\n", statistics.ullHitCount, statistics.ullMissCount);
+	ReplaceFile(strStatisticsPath, szStatistics, static_cast<std::size_t>(nLength), nullptr, 0U);
+
+	return statistics;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "decode.h"
+#include "output.h"
+
+// lookups of the cache directory, counted across all runs that use it
+struct CacheStatistics_t
+{
+	std::uint64_t ullHitCount = 0ULL;
+	std::uint64_t ullMissCount = 0ULL;
+};
+
+/*
+ * persistent cache of the decoded output, keyed by the hash of the tables, the output format with the decoding options, and the contents of the executable itself
+ * @remarks: cache is disabled when the executable can't be read to be hashed. each format and options combination has a single entry, that is replaced once the tables change, so the directory doesn't grow with the table changes.
+ * entries are written to the temporary file and then renamed over the old one, and are validated by the hash of their output, so a partial or corrupt entry is never used
+ */
+class COutputCache
+{
+public:
+	COutputCache(const char* szDirectoryPath, const DecodeOptions_t& options);
+
+	/*
+	 * set the tables to look up, data of both parts is hashed in order
+	 * @param[in] pFirstData entry point, or the whole dump that contains it with the table
+	 * @param[in] pSecondData structure table, may be null when it's included in the first part
+	 */
+	void SetTables(const std::uint8_t* pFirstData, std::size_t nFirstSize, const std::uint8_t* pSecondData, std::size_t nSecondSize, std::uint32_t uVersion);
+	/*
+	 * append the cached output of the tables to the output
+	 * @returns: true if valid entry has been found, false otherwise
+	 */
+	bool Load(COutput& output) const;
+	/*
+	 * store the output decoded from the tables, replacing the entry of the previous tables
+	 * @returns: true if entry has been stored, false otherwise
+	 */
+	bool Store(const char* pOutputData, std::size_t nOutputSize) const;
+	/*
+	 * count the lookup in the statistics of the cache directory
+	 * @returns: statistics including this lookup
+	 * @remarks: lookups of the runs, that update the statistics at the same time, may be lost
+	 */
+	CacheStatistics_t CountLookup(bool bHit) const;
+
+	// @returns: true if the executable has been hashed and the entry can be looked up, false if cache is disabled
+	[[nodiscard]] bool IsEnabled() const
+	{
+		return !strEntryPath.empty();
+	}
+
+	[[nodiscard]] const std::string& GetDirectoryPath() const
+	{
+		return strDirectoryPath;
+	}
+
+private:
+	std::string strDirectoryPath;
+	// path of the entry of the format and options, empty if cache is disabled
+	std::string strEntryPath;
+	std::uint64_t ullTablesHash = 0ULL;
+};
+
+// @returns: XXH64 hash of the data, continuing from the given seed
+std::uint64_t HashData(const void* pData, std::size_t nDataSize, std::uint64_t ullSeed);
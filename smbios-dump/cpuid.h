@@ -0,0 +1,266 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// vendor of the processor, that defines how its signature is read
+enum ECpuVendor : std::uint8_t
+{
+	CPU_VENDOR_UNKNOWN = 0,
+	CPU_VENDOR_INTEL,
+	CPU_VENDOR_AMD,
+	CPU_VENDOR_HYGON,
+	// any implementer of the ARM architecture, that is identified by the main ID register instead
+	CPU_VENDOR_ARM
+};
+
+/*
+ * signature of the processor, that is stored in the processor ID of the processor information structure
+ * @remarks: x86 processors store the 'EAX' value of CPUID leaf 1, that is decoded to the displayed family and model, that include their extended parts,
+ * ARM processors store the value of 'MIDR_EL1' register, that is decoded to the implementer, variant, architecture, part number and revision
+ */
+struct CpuSignature_t
+{
+	ECpuVendor nVendor;
+	std::uint32_t uRawValue;
+	// x86 only
+	std::uint16_t nFamily;
+	std::uint8_t nModel;
+	std::uint8_t nStepping;
+	// ARM only
+	std::uint8_t uImplementer;
+	std::uint8_t nVariant;
+	std::uint8_t nArchitecture;
+	std::uint16_t uPartNumber;
+	std::uint8_t nRevision;
+};
+
+// @returns: signature decoded from the first dword of the processor ID
+[[nodiscard]] constexpr CpuSignature_t DecodeCpuSignature(const ECpuVendor nVendor, const std::uint32_t uRawValue)
+{
+	CpuSignature_t signature = { };
+	signature.nVendor = nVendor;
+	signature.uRawValue = uRawValue;
+
+	if (nVendor == CPU_VENDOR_ARM)
+	{
+		signature.uImplementer = static_cast<std::uint8_t>(uRawValue >> 24U);
+		signature.nVariant = static_cast<std::uint8_t>((uRawValue >> 20U) & 0xFU);
+		signature.nArchitecture = static_cast<std::uint8_t>((uRawValue >> 16U) & 0xFU);
+		signature.uPartNumber = static_cast<std::uint16_t>((uRawValue >> 4U) & 0xFFFU);
+		signature.nRevision = static_cast<std::uint8_t>(uRawValue & 0xFU);
+		return signature;
+	}
+
+	// extended family is added only to the family 0xF, extended model is prepended only to the families 0x6 and 0xF
+	const std::uint32_t nBaseFamily = (uRawValue >> 8U) & 0xFU;
+	const std::uint32_t nBaseModel = (uRawValue >> 4U) & 0xFU;
+	signature.nFamily = static_cast<std::uint16_t>(nBaseFamily == 0xFU ? nBaseFamily + ((uRawValue >> 20U) & 0xFFU) : nBaseFamily);
+	signature.nModel = static_cast<std::uint8_t>(nBaseFamily == 0x6U || nBaseFamily == 0xFU ? (((uRawValue >> 16U) & 0xFU) << 4U) | nBaseModel : nBaseModel);
+	signature.nStepping = static_cast<std::uint8_t>(uRawValue & 0xFU);
+	return signature;
+}
+
+// key of the x86 signature, ordered by the vendor, family, model and stepping
+[[nodiscard]] constexpr std::uint32_t MakeX86SignatureKey(const ECpuVendor nVendor, const std::uint32_t nFamily, const std::uint32_t nModel, const std::uint32_t nStepping)
+{
+	return (static_cast<std::uint32_t>(nVendor) << 24U) | (nFamily << 16U) | (nModel << 8U) | nStepping;
+}
+
+// key of the ARM signature, ordered by the implementer, part number and variant
+[[nodiscard]] constexpr std::uint32_t MakeArmSignatureKey(const std::uint32_t uImplementer, const std::uint32_t uPartNumber, const std::uint32_t nVariant)
+{
+	return (static_cast<std::uint32_t>(CPU_VENDOR_ARM) << 24U) | (uImplementer << 16U) | (uPartNumber << 4U) | nVariant;
+}
+
+// inclusive range of the signature keys, that belong to the same microarchitecture
+struct MicroarchitectureRange_t
+{
+	std::uint32_t uFirstKey;
+	std::uint32_t uLastKey;
+	const char* szName;
+};
+
+// range of all steppings of the x86 models
+[[nodiscard]] constexpr MicroarchitectureRange_t X86Models(const ECpuVendor nVendor, const std::uint32_t nFamily, const std::uint32_t nFirstModel, const std::uint32_t nLastModel, const char* szName)
+{
+	return { MakeX86SignatureKey(nVendor, nFamily, nFirstModel, 0x0U), MakeX86SignatureKey(nVendor, nFamily, nLastModel, 0xFU), szName };
+}
+
+// range of the steppings of the single x86 model, e.g. for the generations that share the model number
+[[nodiscard]] constexpr MicroarchitectureRange_t X86Steppings(const ECpuVendor nVendor, const std::uint32_t nFamily, const std::uint32_t nModel, const std::uint32_t nFirstStepping, const std::uint32_t nLastStepping, const char* szName)
+{
+	return { MakeX86SignatureKey(nVendor, nFamily, nModel, nFirstStepping), MakeX86SignatureKey(nVendor, nFamily, nModel, nLastStepping), szName };
+}
+
+// range of all variants of the ARM part
+[[nodiscard]] constexpr MicroarchitectureRange_t ArmPart(const std::uint32_t uImplementer, const std::uint32_t uPartNumber, const char* szName)
+{
+	return { MakeArmSignatureKey(uImplementer, uPartNumber, 0x0U), MakeArmSignatureKey(uImplementer, uPartNumber, 0xFU), szName };
+}
+
+// ranges of the known signatures, in ascending order of the keys
+inline constexpr MicroarchitectureRange_t arrMicroarchitectures[] =
+{
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x0FU, 0x0FU, "Core"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x16U, 0x16U, "Core"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x17U, 0x17U, "Penryn"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x1AU, 0x1AU, "Nehalem"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x1DU, 0x1DU, "Penryn"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x1EU, 0x1FU, "Nehalem"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x25U, 0x25U, "Westmere"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x2AU, 0x2AU, "Sandy Bridge"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x2CU, 0x2CU, "Westmere"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x2DU, 0x2DU, "Sandy Bridge"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x2EU, 0x2EU, "Nehalem"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x2FU, 0x2FU, "Westmere"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x3AU, 0x3AU, "Ivy Bridge"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x3CU, 0x3CU, "Haswell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x3DU, 0x3DU, "Broadwell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x3EU, 0x3EU, "Ivy Bridge"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x3FU, 0x3FU, "Haswell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x45U, 0x46U, "Haswell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x47U, 0x47U, "Broadwell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x4EU, 0x4EU, "Skylake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x4FU, 0x4FU, "Broadwell"),
+	X86Steppings(CPU_VENDOR_INTEL, 0x6U, 0x55U, 0x0U, 0x4U, "Skylake-SP"),
+	X86Steppings(CPU_VENDOR_INTEL, 0x6U, 0x55U, 0x5U, 0x7U, "Cascade Lake"),
+	X86Steppings(CPU_VENDOR_INTEL, 0x6U, 0x55U, 0xAU, 0xBU, "Cooper Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x56U, 0x56U, "Broadwell"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x57U, 0x57U, "Knights Landing"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x5CU, 0x5CU, "Goldmont"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x5EU, 0x5EU, "Skylake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x5FU, 0x5FU, "Goldmont"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x66U, 0x66U, "Cannon Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x6AU, 0x6AU, "Ice Lake-SP"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x6CU, 0x6CU, "Ice Lake-SP"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x7AU, 0x7AU, "Goldmont Plus"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x7DU, 0x7EU, "Ice Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x85U, 0x85U, "Knights Mill"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x86U, 0x86U, "Tremont"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x8CU, 0x8DU, "Tiger Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x8EU, 0x8EU, "Kaby Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x8FU, 0x8FU, "Sapphire Rapids"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x96U, 0x96U, "Tremont"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x97U, 0x97U, "Alder Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x9AU, 0x9AU, "Alder Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0x9CU, 0x9CU, "Tremont"),
+	X86Steppings(CPU_VENDOR_INTEL, 0x6U, 0x9EU, 0x0U, 0x9U, "Kaby Lake"),
+	X86Steppings(CPU_VENDOR_INTEL, 0x6U, 0x9EU, 0xAU, 0xDU, "Coffee Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xA5U, 0xA6U, "Comet Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xA7U, 0xA7U, "Rocket Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xAAU, 0xAAU, "Meteor Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xACU, 0xACU, "Meteor Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xADU, 0xAEU, "Granite Rapids"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xAFU, 0xAFU, "Sierra Forest"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xB6U, 0xB6U, "Grand Ridge"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xB7U, 0xB7U, "Raptor Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xBAU, 0xBAU, "Raptor Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xBDU, 0xBDU, "Lunar Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xBFU, 0xBFU, "Raptor Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xC5U, 0xC6U, "Arrow Lake"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xCFU, 0xCFU, "Emerald Rapids"),
+	X86Models(CPU_VENDOR_INTEL, 0x6U, 0xDDU, 0xDDU, "Clearwater Forest"),
+	X86Models(CPU_VENDOR_INTEL, 0xFU, 0x00U, 0x06U, "NetBurst"),
+
+	X86Models(CPU_VENDOR_AMD, 0xFU, 0x00U, 0xFFU, "K8"),
+	X86Models(CPU_VENDOR_AMD, 0x10U, 0x00U, 0xFFU, "K10"),
+	X86Models(CPU_VENDOR_AMD, 0x12U, 0x00U, 0xFFU, "K10"),
+	X86Models(CPU_VENDOR_AMD, 0x14U, 0x00U, 0xFFU, "Bobcat"),
+	X86Models(CPU_VENDOR_AMD, 0x15U, 0x00U, 0x0FU, "Bulldozer"),
+	X86Models(CPU_VENDOR_AMD, 0x15U, 0x10U, 0x1FU, "Piledriver"),
+	X86Models(CPU_VENDOR_AMD, 0x15U, 0x30U, 0x3FU, "Steamroller"),
+	X86Models(CPU_VENDOR_AMD, 0x15U, 0x60U, 0x7FU, "Excavator"),
+	X86Models(CPU_VENDOR_AMD, 0x16U, 0x00U, 0x0FU, "Jaguar"),
+	X86Models(CPU_VENDOR_AMD, 0x16U, 0x30U, 0x3FU, "Puma"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x00U, 0x07U, "Zen"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x08U, 0x08U, "Zen+"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x09U, 0x17U, "Zen"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x18U, 0x18U, "Zen+"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x19U, 0x2FU, "Zen"),
+	X86Models(CPU_VENDOR_AMD, 0x17U, 0x30U, 0xFFU, "Zen 2"),
+	X86Models(CPU_VENDOR_AMD, 0x19U, 0x00U, 0x0FU, "Zen 3"),
+	X86Models(CPU_VENDOR_AMD, 0x19U, 0x10U, 0x1FU, "Zen 4"),
+	X86Models(CPU_VENDOR_AMD, 0x19U, 0x20U, 0x5FU, "Zen 3"),
+	X86Models(CPU_VENDOR_AMD, 0x19U, 0x60U, 0xAFU, "Zen 4"),
+	X86Models(CPU_VENDOR_AMD, 0x1AU, 0x00U, 0x2FU, "Zen 5"),
+	X86Models(CPU_VENDOR_AMD, 0x1AU, 0x40U, 0x4FU, "Zen 5"),
+	X86Models(CPU_VENDOR_AMD, 0x1AU, 0x60U, 0x7FU, "Zen 5"),
+
+	X86Models(CPU_VENDOR_HYGON, 0x18U, 0x00U, 0xFFU, "Dhyana"),
+
+	ArmPart(0x41U, 0xD03U, "Cortex-A53"),
+	ArmPart(0x41U, 0xD04U, "Cortex-A35"),
+	ArmPart(0x41U, 0xD05U, "Cortex-A55"),
+	ArmPart(0x41U, 0xD07U, "Cortex-A57"),
+	ArmPart(0x41U, 0xD08U, "Cortex-A72"),
+	ArmPart(0x41U, 0xD09U, "Cortex-A73"),
+	ArmPart(0x41U, 0xD0AU, "Cortex-A75"),
+	ArmPart(0x41U, 0xD0BU, "Cortex-A76"),
+	ArmPart(0x41U, 0xD0CU, "Neoverse N1"),
+	ArmPart(0x41U, 0xD0DU, "Cortex-A77"),
+	ArmPart(0x41U, 0xD40U, "Neoverse V1"),
+	ArmPart(0x41U, 0xD41U, "Cortex-A78"),
+	ArmPart(0x41U, 0xD44U, "Cortex-X1"),
+	ArmPart(0x41U, 0xD46U, "Cortex-A510"),
+	ArmPart(0x41U, 0xD47U, "Cortex-A710"),
+	ArmPart(0x41U, 0xD48U, "Cortex-X2"),
+	ArmPart(0x41U, 0xD49U, "Neoverse N2"),
+	ArmPart(0x41U, 0xD4AU, "Neoverse E1"),
+	ArmPart(0x41U, 0xD4BU, "Cortex-A78C"),
+	ArmPart(0x41U, 0xD4DU, "Cortex-A715"),
+	ArmPart(0x41U, 0xD4EU, "Cortex-X3"),
+	ArmPart(0x41U, 0xD4FU, "Neoverse V2"),
+	ArmPart(0x41U, 0xD80U, "Cortex-A520"),
+	ArmPart(0x41U, 0xD81U, "Cortex-A720"),
+	ArmPart(0x41U, 0xD82U, "Cortex-X4"),
+	ArmPart(0x41U, 0xD84U, "Neoverse V3"),
+	ArmPart(0x41U, 0xD8EU, "Neoverse N3"),
+	ArmPart(0x42U, 0x516U, "Vulcan"),
+	ArmPart(0x43U, 0x0A1U, "ThunderX"),
+	ArmPart(0x43U, 0x0AFU, "ThunderX2"),
+	ArmPart(0x46U, 0x001U, "A64FX"),
+	ArmPart(0x48U, 0xD01U, "TaiShan v110"),
+	ArmPart(0x4EU, 0x004U, "Carmel"),
+	ArmPart(0x50U, 0x000U, "X-Gene"),
+	ArmPart(0xC0U, 0xAC3U, "AmpereOne")
+};
+
+template <std::size_t N>
+[[nodiscard]] consteval bool AreRangesOrdered(const MicroarchitectureRange_t (&arrRanges)[N])
+{
+	for (std::size_t i = 0U; i < N; ++i)
+	{
+		if (arrRanges[i].uFirstKey > arrRanges[i].uLastKey || (i > 0U && arrRanges[i - 1U].uLastKey >= arrRanges[i].uFirstKey))
+			return false;
+	}
+
+	return true;
+}
+
+static_assert(AreRangesOrdered(arrMicroarchitectures), "microarchitecture ranges must be in ascending order and must not overlap");
+
+// @returns: name of the microarchitecture of the signature, null if it's not known
+[[nodiscard]] constexpr const char* FindMicroarchitecture(const CpuSignature_t& signature)
+{
+	std::uint32_t uKey;
+	if (signature.nVendor == CPU_VENDOR_ARM)
+		uKey = MakeArmSignatureKey(signature.uImplementer, signature.uPartNumber, signature.nVariant);
+	// families above 0xFF can't be stored by the key, and there are none of them yet
+	else if (signature.nVendor != CPU_VENDOR_UNKNOWN && signature.nFamily <= 0xFFU)
+		uKey = MakeX86SignatureKey(signature.nVendor, signature.nFamily, signature.nModel, signature.nStepping);
+	else
+		return nullptr;
+
+	// binary search of the last range, that begins at or before the key
+	std::size_t nBegin = 0U, nEnd = sizeof(arrMicroarchitectures) / sizeof(arrMicroarchitectures[0]);
+	while (nBegin < nEnd)
+	{
+		const std::size_t nMiddle = (nBegin + nEnd) / 2U;
+		if (arrMicroarchitectures[nMiddle].uFirstKey <= uKey)
+			nBegin = nMiddle + 1U;
+		else
+			nEnd = nMiddle;
+	}
+
+	return nBegin > 0U && uKey <= arrMicroarchitectures[nBegin - 1U].uLastKey ? arrMicroarchitectures[nBegin - 1U].szName : nullptr;
+}
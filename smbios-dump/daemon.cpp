@@ -0,0 +1,496 @@
+#include "daemon.h"
+
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include <q-tee/common/common.h>
+
+#if !defined(Q_OS_WINDOWS)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "emitter.h"
+#include "scanner.h"
+
+// @returns: pointer past the JSON value that begins at the given position, or to the separator ending it, as written by the emitter without any whitespace
+static const char* SkipValue(const char* pCurrent, const char* pEnd)
+{
+	std::size_t nDepth = 0U;
+	bool bInString = false;
+	for (; pCurrent < pEnd; ++pCurrent)
+	{
+		const char chCurrent = *pCurrent;
+		if (bInString)
+		{
+			if (chCurrent == '\\')
+				++pCurrent;
+			else if (chCurrent == '"')
+			{
+				bInString = false;
+				if (nDepth == 0U)
+					return pCurrent + 1;
+			}
+
+			continue;
+		}
+
+		if (chCurrent == '"')
+			bInString = true;
+		else if (chCurrent == '{' || chCurrent == '[')
+			++nDepth;
+		else if (chCurrent == '}' || chCurrent == ']')
+		{
+			if (nDepth == 0U)
+				return pCurrent;
+
+			if (--nDepth == 0U)
+				return pCurrent + 1;
+		}
+		else if (chCurrent == ',' && nDepth == 0U)
+			return pCurrent;
+	}
+
+	return pEnd;
+}
+
+/*
+ * call the function for each member of the JSON object, that begins at the given position
+ * @param[in] fnMember callable with signature 'void(const char* pName, std::size_t nNameLength, const char* pValue, const char* pValueEnd)'
+ */
+template <typename T>
+static void ForEachMember(const char* pObject, const char* pEnd, T&& fnMember)
+{
+	const char* pCurrent = pObject + 1;
+	// member names are derived from the labels, so they're never escaped
+	while (pCurrent < pEnd && *pCurrent == '"')
+	{
+		const char* pName = pCurrent + 1;
+		const char* pNameEnd = static_cast<const char*>(std::memchr(pName, '"', static_cast<std::size_t>(pEnd - pName)));
+		if (pNameEnd == nullptr || pNameEnd + 1 >= pEnd)
+			return;
+
+		const char* pValue = pNameEnd + 2;
+		const char* pValueEnd = SkipValue(pValue, pEnd);
+		fnMember(pName, static_cast<std::size_t>(pNameEnd - pName), pValue, pValueEnd);
+
+		if (pValueEnd >= pEnd || *pValueEnd != ',')
+			return;
+
+		pCurrent = pValueEnd + 1;
+	}
+}
+
+bool CTableModel::Build(DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, const std::size_t nTableSize, const std::uint32_t uVersion)
+{
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	const bool bReachedEnd = FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	CHandleIndex* pHandleIndex = (options.bResolveHandles ? &state.handleIndex : nullptr);
+	if (pHandleIndex != nullptr)
+	{
+		pHandleIndex->Reset(pTableData);
+
+		for (std::size_t i = 0U; i < nStructureCount; ++i)
+			pHandleIndex->Insert(reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]));
+	}
+
+	// each structure is the separate line of the same buffer, so it's answered by copying it as is
+	CEmitter emitter(outputDocuments, OUTPUT_FORMAT_NDJSON);
+	emitter.BeginTable(uVersion);
+
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (!options.IsTypeWanted(pStructure->nType))
+			continue;
+
+		const std::size_t nDocumentOffset = outputDocuments.GetSize();
+		DumpStructure(emitter, pStructure, pTableData + vecBoundaries[i + 1U], uVersion, pHandleIndex);
+		vecStructures.push_back({ static_cast<std::uint32_t>(nDocumentOffset), static_cast<std::uint32_t>(outputDocuments.GetSize() - nDocumentOffset - 1U), pStructure->uHandle, pStructure->nType });
+	}
+
+	// documents are indexed only once all of them are decoded, as the buffer may be moved while it grows
+	pHandleStructures.reset(new std::uint32_t[0x10000]());
+	for (std::uint32_t i = 0U; i < vecStructures.size(); ++i)
+	{
+		const Structure_t& structure = vecStructures[i];
+
+		// when structure handle is duplicated, the first structure is kept, as the handle index does
+		if (pHandleStructures[structure.uHandle] == 0U)
+			pHandleStructures[structure.uHandle] = i + 1U;
+
+		arrTypeStructures[structure.nType].push_back(i);
+		IndexFields(i);
+	}
+
+	return bReachedEnd;
+}
+
+void CTableModel::IndexFields(const std::uint32_t uStructureIndex)
+{
+	const Structure_t& structure = vecStructures[uStructureIndex];
+	const char* pDocument = outputDocuments.GetData() + structure.uDocumentOffset;
+	const char* pDocumentEnd = pDocument + structure.uDocumentLength;
+
+	ForEachMember(pDocument, pDocumentEnd, [&](const char* pName, const std::size_t nNameLength, const char* pValue, const char* pValueEnd)
+	{
+		if (nNameLength != 6U || std::memcmp(pName, "fields", 6U) != 0 || *pValue != '{')
+			return;
+
+		ForEachMember(pValue, pValueEnd, [&](const char* pFieldName, const std::size_t nFieldNameLength, const char* pFieldValue, const char* pFieldValueEnd)
+		{
+			mapFieldValues[std::string(pFieldName, nFieldNameLength)].push_back({ uStructureIndex, static_cast<std::uint32_t>(pFieldValue - outputDocuments.GetData()), static_cast<std::uint32_t>(pFieldValueEnd - pFieldValue) });
+		});
+	});
+}
+
+void CTableModel::AppendDocument(COutput& output, const std::uint32_t uStructureIndex) const
+{
+	const Structure_t& structure = vecStructures[uStructureIndex];
+	output.Append(COutput::String_t{ outputDocuments.GetData() + structure.uDocumentOffset, structure.uDocumentLength });
+}
+
+void CTableModel::QueryHandle(COutput& output, const std::uint16_t uHandle) const
+{
+	if (const std::uint32_t uStructureIndex = pHandleStructures[uHandle]; uStructureIndex != 0U)
+		AppendDocument(output, uStructureIndex - 1U);
+	else
+		output.Print("{\"error\":\"no structure with handle 0x", COutput::Hex(uHandle, 4), "\"}");
+}
+
+void CTableModel::QueryType(COutput& output, const std::uint8_t nType) const
+{
+	output.Append('[');
+	for (std::size_t i = 0U; i < arrTypeStructures[nType].size(); ++i)
+	{
+		if (i > 0U)
+			output.Append(',');
+
+		AppendDocument(output, arrTypeStructures[nType][i]);
+	}
+	output.Append(']');
+}
+
+void CTableModel::QueryField(COutput& output, const char* szName, const int iType) const
+{
+	output.Append('[');
+
+	if (const auto itFieldValues = mapFieldValues.find(szName); itFieldValues != mapFieldValues.end())
+	{
+		bool bNeedSeparator = false;
+		for (const FieldValue_t& fieldValue : itFieldValues->second)
+		{
+			const Structure_t& structure = vecStructures[fieldValue.uStructureIndex];
+			if (iType >= 0 && structure.nType != iType)
+				continue;
+
+			if (bNeedSeparator)
+				output.Append(',');
+			bNeedSeparator = true;
+
+			output.Print("{\"handle\":", structure.uHandle, ",\"type\":", structure.nType, ",\"value\":", COutput::String_t{ outputDocuments.GetData() + fieldValue.uValueOffset, fieldValue.uValueLength }, '}');
+		}
+	}
+
+	output.Append(']');
+}
+
+// @returns: next word of the request, that is terminated by the space or null character, null if there are no more words
+static const char* NextWord(const char*& pCurrent, std::size_t* pnLength)
+{
+	while (*pCurrent == ' ' || *pCurrent == '\t')
+		++pCurrent;
+
+	if (*pCurrent == '\0')
+		return nullptr;
+
+	const char* pWord = pCurrent;
+	pCurrent += std::strcspn(pCurrent, " \t");
+	*pnLength = static_cast<std::size_t>(pCurrent - pWord);
+	return pWord;
+}
+
+/*
+ * parse the number of the request, either decimal or hexadecimal with '0x' prefix
+ * @returns: true if the whole word is the number not exceeding the given maximum, false otherwise
+ */
+static bool ParseNumber(const char* pWord, const std::size_t nLength, const unsigned long ulMaximum, unsigned long* pulValue)
+{
+	// words are limited by the request line, so the number is copied to be terminated
+	char szNumber[24];
+	if (pWord == nullptr || nLength >= sizeof(szNumber))
+		return false;
+
+	std::memcpy(szNumber, pWord, nLength);
+	szNumber[nLength] = '\0';
+
+	char* szNumberEnd = nullptr;
+	*pulValue = std::strtoul(szNumber, &szNumberEnd, 0);
+	return szNumberEnd != szNumber && *szNumberEnd == '\0' && *pulValue <= ulMaximum;
+}
+
+void CTableModel::Query(COutput& output, const char* szRequest) const
+{
+	const char* pCurrent = szRequest;
+	std::size_t nCommandLength = 0U;
+	const char* pCommand = NextWord(pCurrent, &nCommandLength);
+
+	std::size_t nArgumentLength = 0U;
+	const char* pArgument = NextWord(pCurrent, &nArgumentLength);
+	std::size_t nOptionalArgumentLength = 0U;
+	const char* pOptionalArgument = NextWord(pCurrent, &nOptionalArgumentLength);
+	std::size_t nExtraLength = 0U;
+	const bool bExtra = (NextWord(pCurrent, &nExtraLength) != nullptr);
+
+	const auto fnIsCommand = [&](const char* szCommand)
+	{
+		return pCommand != nullptr && std::strlen(szCommand) == nCommandLength && std::memcmp(pCommand, szCommand, nCommandLength) == 0;
+	};
+
+	unsigned long ulValue = 0UL;
+	if (fnIsCommand("table") && pArgument == nullptr)
+	{
+		output.Append('[');
+		for (std::uint32_t i = 0U; i < vecStructures.size(); ++i)
+		{
+			if (i > 0U)
+				output.Append(',');
+
+			AppendDocument(output, i);
+		}
+		output.Append(']');
+	}
+	else if (fnIsCommand("handle") && pOptionalArgument == nullptr && ParseNumber(pArgument, nArgumentLength, 0xFFFF, &ulValue))
+		QueryHandle(output, static_cast<std::uint16_t>(ulValue));
+	else if (fnIsCommand("type") && pOptionalArgument == nullptr && ParseNumber(pArgument, nArgumentLength, 0xFF, &ulValue))
+		QueryType(output, static_cast<std::uint8_t>(ulValue));
+	else if (fnIsCommand("field") && pArgument != nullptr && !bExtra && (pOptionalArgument == nullptr || ParseNumber(pOptionalArgument, nOptionalArgumentLength, 0xFF, &ulValue)))
+		QueryField(output, std::string(pArgument, nArgumentLength).c_str(), pOptionalArgument != nullptr ? static_cast<int>(ulValue) : -1);
+	else
+		output.Print("{\"error\":\"invalid request, expected 'table', 'handle <handle>', 'type <type>' or 'field <name> [type]'\"}");
+
+	output.Append('\n');
+}
+
+#if defined(Q_OS_WINDOWS)
+bool RunDaemon([[maybe_unused]] const char* szSocketPath, [[maybe_unused]] const CTableModel& model)
+{
+	std::printf("[error] daemon mode is not supported on windows\n");
+	return false;
+}
+#else
+// set by the signal handler to stop accepting the connections
+static volatile std::sig_atomic_t bStopRequested = 0;
+
+static void OnStopSignal([[maybe_unused]] int iSignal)
+{
+	bStopRequested = 1;
+}
+
+// @returns: true if the whole buffered text has been sent, false otherwise
+static bool SendOutput(const int iSocket, const COutput& output)
+{
+	const char* pCurrent = output.GetData();
+	std::size_t nRemainingSize = output.GetSize();
+	while (nRemainingSize > 0U)
+	{
+		const ssize_t nSent = ::send(iSocket, pCurrent, nRemainingSize, 0);
+		if (nSent < 0 && errno == EINTR)
+			continue;
+
+		if (nSent <= 0)
+			return false;
+
+		pCurrent += nSent;
+		nRemainingSize -= static_cast<std::size_t>(nSent);
+	}
+
+	return true;
+}
+
+// answer the requests of the single connection until it's closed by the client or shut down by the daemon
+static void ServeConnection(const int iSocket, const CTableModel& model)
+{
+	// requests are short, so the line that doesn't fit the buffer isn't a valid request
+	char arrRequests[4096];
+	std::size_t nBufferedSize = 0U;
+	COutput output(4096U);
+
+	while (true)
+	{
+		const ssize_t nReceived = ::recv(iSocket, arrRequests + nBufferedSize, sizeof(arrRequests) - nBufferedSize, 0);
+		if (nReceived < 0 && errno == EINTR)
+			continue;
+
+		if (nReceived <= 0)
+			return;
+
+		nBufferedSize += static_cast<std::size_t>(nReceived);
+
+		// answer all complete requests at once, so the pipelined requests are sent back with the single call
+		char* pRequest = arrRequests;
+		char* pRequestEnd = nullptr;
+		while ((pRequestEnd = static_cast<char*>(std::memchr(pRequest, '\n', static_cast<std::size_t>(arrRequests + nBufferedSize - pRequest)))) != nullptr)
+		{
+			*pRequestEnd = '\0';
+			if (pRequestEnd > pRequest && pRequestEnd[-1] == '\r')
+				pRequestEnd[-1] = '\0';
+
+			if (*pRequest != '\0')
+				model.Query(output, pRequest);
+
+			pRequest = pRequestEnd + 1;
+		}
+
+		nBufferedSize -= static_cast<std::size_t>(pRequest - arrRequests);
+		std::memmove(arrRequests, pRequest, nBufferedSize);
+
+		if (nBufferedSize == sizeof(arrRequests))
+		{
+			output.Print("{\"error\":\"request exceeds ", sizeof(arrRequests), " bytes\"}\n");
+			SendOutput(iSocket, output);
+			return;
+		}
+
+		if (!SendOutput(iSocket, output))
+			return;
+
+		output.Clear();
+	}
+}
+
+/*
+ * bind the socket to the given path, replacing the stale socket file left by the daemon that didn't exit cleanly
+ * @returns: true if socket has been bound, false otherwise
+ */
+static bool BindSocket(const int iSocket, const sockaddr_un& address)
+{
+	if (::bind(iSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+		return true;
+
+	if (errno != EADDRINUSE)
+		return false;
+
+	// the path is in use by the running daemon only when it accepts the connections
+	const int iProbeSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (iProbeSocket < 0)
+		return false;
+
+	const bool bInUse = (::connect(iProbeSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0 || errno != ECONNREFUSED);
+	::close(iProbeSocket);
+
+	if (bInUse)
+	{
+		errno = EADDRINUSE;
+		return false;
+	}
+
+	::unlink(address.sun_path);
+	return ::bind(iSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+}
+
+bool RunDaemon(const char* szSocketPath, const CTableModel& model)
+{
+	sockaddr_un address = { };
+	address.sun_family = AF_UNIX;
+	if (std::strlen(szSocketPath) >= sizeof(address.sun_path))
+	{
+		std::printf("[error] socket path exceeds %zu characters: %s\n", sizeof(address.sun_path) - 1U, szSocketPath);
+		return false;
+	}
+	std::strcpy(address.sun_path, szSocketPath);
+
+	const int iListenSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (iListenSocket < 0 || !BindSocket(iListenSocket, address) || ::listen(iListenSocket, SOMAXCONN) != 0)
+	{
+		std::printf("[error] failed to listen on socket: %s (%s)\n", szSocketPath, std::strerror(errno));
+		if (iListenSocket >= 0)
+			::close(iListenSocket);
+		return false;
+	}
+
+	// interrupt the blocking accept instead of restarting it, so the stop request is noticed
+	struct sigaction stopAction = { };
+	stopAction.sa_handler = OnStopSignal;
+	::sigemptyset(&stopAction.sa_mask);
+	::sigaction(SIGINT, &stopAction, nullptr);
+	::sigaction(SIGTERM, &stopAction, nullptr);
+	// closed connection is reported by the failed send instead
+	std::signal(SIGPIPE, SIG_IGN);
+
+	std::fprintf(stderr, "[daemon] serving %zu structures on %s\n", model.GetStructureCount(), szSocketPath);
+
+	struct Connection_t
+	{
+		int iSocket;
+		std::thread thread;
+		std::atomic<bool> bFinished { false };
+	};
+	std::vector<std::unique_ptr<Connection_t>> vecConnections;
+
+	// connection socket is closed only once its thread is joined, so its descriptor can't be reused while it's shut down
+	const auto fnReleaseConnection = [](Connection_t& connection)
+	{
+		connection.thread.join();
+		::close(connection.iSocket);
+	};
+
+	while (bStopRequested == 0)
+	{
+		const int iSocket = ::accept(iListenSocket, nullptr, nullptr);
+		if (iSocket < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+
+			std::printf("[error] failed to accept connection: %s\n", std::strerror(errno));
+			break;
+		}
+
+		// release connections that have been closed since the previous accept
+		for (std::size_t i = 0U; i < vecConnections.size();)
+		{
+			if (vecConnections[i]->bFinished.load(std::memory_order_acquire))
+			{
+				fnReleaseConnection(*vecConnections[i]);
+				vecConnections[i] = std::move(vecConnections.back());
+				vecConnections.pop_back();
+			}
+			else
+				++i;
+		}
+
+		auto pConnection = std::make_unique<Connection_t>();
+		pConnection->iSocket = iSocket;
+		pConnection->thread = std::thread([&model, &connection = *pConnection]()
+		{
+			ServeConnection(connection.iSocket, model);
+			// the client waiting for the end of the answers gets it now, while the descriptor is closed only once the thread is joined
+			::shutdown(connection.iSocket, SHUT_RDWR);
+			connection.bFinished.store(true, std::memory_order_release);
+		});
+		vecConnections.push_back(std::move(pConnection));
+	}
+
+	::close(iListenSocket);
+	::unlink(szSocketPath);
+
+	// wake up the connections waiting for the requests, so the model isn't used after return
+	for (const std::unique_ptr<Connection_t>& pConnection : vecConnections)
+		::shutdown(pConnection->iSocket, SHUT_RDWR);
+
+	for (const std::unique_ptr<Connection_t>& pConnection : vecConnections)
+		fnReleaseConnection(*pConnection);
+
+	std::fprintf(stderr, "[daemon] stopped\n");
+	return bStopRequested != 0;
+}
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "decode.h"
+#include "output.h"
+
+/*
+ * in-memory model of the single table, that is decoded once to the JSON documents of its structures, indexed by their handles, types and field member names
+ * @remarks: model isn't changed once it's built, so it's queried by any count of threads at once without locking. responses are single lines of JSON, failed queries are answered with '{ "error" }' document
+ */
+class CTableModel
+{
+public:
+	/*
+	 * decode the structures of the table, that are wanted by the options, and index them
+	 * @returns: true if the whole table has been decoded, false if it's truncated, the complete structures are indexed anyway
+	 */
+	bool Build(DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, std::size_t nTableSize, std::uint32_t uVersion);
+
+	/*
+	 * answer the single request, that is one of:
+	 * 'table' - array of all structures
+	 * 'handle <handle>' - structure with the given handle
+	 * 'type <type>' - array of the structures of the given type
+	 * 'field <name> [type]' - array of the values of the field with the given JSON member name, optionally of the structures of the given type only
+	 * @param[in] szRequest request line without the line feed
+	 */
+	void Query(COutput& output, const char* szRequest) const;
+
+	[[nodiscard]] std::size_t GetStructureCount() const
+	{
+		return vecStructures.size();
+	}
+
+private:
+	struct Structure_t
+	{
+		std::uint32_t uDocumentOffset;
+		std::uint32_t uDocumentLength;
+		std::uint16_t uHandle;
+		std::uint8_t nType;
+	};
+
+	// value of the field within the document of its structure
+	struct FieldValue_t
+	{
+		std::uint32_t uStructureIndex;
+		std::uint32_t uValueOffset;
+		std::uint32_t uValueLength;
+	};
+
+	// index the members of the fields object of the structure document
+	void IndexFields(std::uint32_t uStructureIndex);
+
+	void AppendDocument(COutput& output, std::uint32_t uStructureIndex) const;
+	void QueryHandle(COutput& output, std::uint16_t uHandle) const;
+	void QueryType(COutput& output, std::uint8_t nType) const;
+	// @param[in] iType type of the structures to search, negative to search all structures
+	void QueryField(COutput& output, const char* szName, int iType) const;
+
+	// documents of the structures in the table order, each followed by the line feed
+	COutput outputDocuments;
+	std::vector<Structure_t> vecStructures;
+	// index of the structure with each handle increased by one, zero if there's none, allocated on build
+	std::unique_ptr<std::uint32_t[]> pHandleStructures;
+	// indices of the structures of each type in the table order
+	std::vector<std::uint32_t> arrTypeStructures[256];
+	// values of each field in the table order, by its member name
+	std::map<std::string, std::vector<FieldValue_t>, std::less<>> mapFieldValues;
+};
+
+/*
+ * serve the queries to the model over the unix domain socket at the given path, until the process is interrupted or terminated
+ * @remarks: each request and response is the single line, several requests may be sent over the same connection. each connection is served by its own thread
+ * @returns: true if daemon has been stopped by the signal, false if socket can't be served
+ */
+bool RunDaemon(const char* szSocketPath, const CTableModel& model);
@@ -0,0 +1,3544 @@
+#include "decode.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "cpuid.h"
+#include "descriptor.h"
+#include "lookup.h"
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+
+constexpr const char* arrStructureType[] =
+{
+	"Platform Firmware Information",
+	"System Information",
+	"Baseboard Information",
+	"System Enclosure",
+	"Processor Information",
+	"Memory Controller Information",
+	"Memory Module Information",
+	"Cache Information",
+	"Port Connector Information",
+	"System Slots",
+	"On-board Devices Information",
+	"OEM Strings",
+	"System Configuration Options",
+	"Firmware Language Information",
+	"Group Associations",
+	"System Event Log",
+	"Physical Memory Array",
+	"Memory Device",
+	"Memory 32-bit Error Information",
+	"Memory Array Mapped Address",
+	"Memory Device Mapped Address",
+	"Built-in Pointing Device",
+	"Portable Battery",
+	"System Reset",
+	"Hardware Security",
+	"System Power Controls",
+	"Voltage Probe",
+	"Cooling Device",
+	"Termperature Probe",
+	"Electrical Current Probe",
+	"Out-of-band Remote Access",
+	"Boot Integrity Services",
+	"System Boot Information",
+	"Memory 64-bit Error Information",
+	"Management Device",
+	"Management Device Component",
+	"Management Device Threshold Data",
+	"Memory Channel",
+	"IPMI Device Information",
+	"System Power Supply",
+	"Additional Information",
+	"On-board Devices Extended Information",
+	"Management Controller Host Interface",
+	"TPM Device",
+	"Processor Additional Information",
+	"Firmware Inventory Information",
+	"String Property"
+};
+
+constexpr const char* arrBaseBoardType[] =
+{
+	"Unknown",
+	"Other",
+	"Server Blade",
+	"Connectivity Switch",
+	"System Management Module",
+	"Processor Module",
+	"I/O Module",
+	"Memory Module",
+	"Daughter board",
+	"Motherboard",
+	"Processor/Memory Module",
+	"Processor/IO Module",
+	"Interconnect board"
+};
+
+constexpr const char* arrMemoryType[] =
+{
+	"Other",
+	"Unknown",
+	"Standard",
+	"Fast Page Mode",
+	"EDO",
+	"Parity",
+	"ECC",
+	"SIMM",
+	"DIMM",
+	"Burst EDO",
+	"SDRAM",
+};
+
+constexpr const char* arrOnBoardDeviceType[] =
+{
+	"Other",
+	"Unknown",
+	"Video",
+	"SCSI Controller",
+	"Ethernet",
+	"Token Ring",
+	"Sound",
+	"PATA Controller",
+	"SATA Controller",
+	"SAS Controller",
+	"Wireless LAN",
+	"Bluetooth",
+	"WWAN",
+	"eMMC",
+	"NVMe Controller",
+	"UFS Controller"
+};
+
+constexpr const char* arrMemoryErrorType[] =
+{
+	"Other",
+	"Unknown",
+	"OK",
+	"Bad Read",
+	"Parity",
+	"Single-bit",
+	"Double-bit",
+	"Multi-bit",
+	"Nibble",
+	"Checksum",
+	"CRC",
+	"Corrected Single-bit",
+	"Corrected",
+	"Uncorrectable"
+};
+
+constexpr const char* arrMemoryErrorGranularity[] =
+{
+	"Other",
+	"Unknown",
+	"Device Level",
+	"Memory Partition Level"
+};
+
+constexpr const char* arrMemoryErrorOperation[] =
+{
+	"Other",
+	"Unknown",
+	"Read",
+	"Write",
+	"Partial Write"
+};
+
+constexpr const char* arrProbeLocation[] =
+{
+	"Other",
+	"Unknown",
+	"Processor",
+	"Disk",
+	"Peripheral Bay",
+	"System Management Module",
+	"Motherboard",
+	"Memory Module",
+	"Processor Module",
+	"Power Unit",
+	"Add-in Card",
+	"Front Panel Board",
+	"Back Panel Board",
+	"Power System Board",
+	"Drive Back Plane"
+};
+
+constexpr const char* arrStatus[] =
+{
+	"Other",
+	"Unknown",
+	"OK",
+	"Non-critical",
+	"Critical",
+	"Non-recoverable"
+};
+
+constexpr const char* arrSizeUnit[] =
+{
+	"KiB",
+	"MiB",
+	"GiB"
+};
+
+constexpr const char* arrVoltage[] =
+{
+	"5V",
+	"3.3V",
+	"2.9V"
+};
+
+static const char* GetStructureTypeName(const std::uint8_t nType)
+{
+	return nType > SMBIOS::TYPE_END_OF_TABLE ? "OEM Specific" :
+		nType == SMBIOS::TYPE_INACTIVE ? "Inactive" :
+		nType == SMBIOS::TYPE_END_OF_TABLE ? "End of Table" :
+		arrStructureType[nType];
+}
+
+static const char* GetMemoryArrayLocationName(const SMBIOS::MemoryArrayLocation_t nLocation)
+{
+	using namespace SMBIOS;
+	static constexpr EnumName_t arrLocation[] =
+	{
+		{ MEMORY_ARRAY_LOCATION_OTHER, "Other" },
+		{ MEMORY_ARRAY_LOCATION_UNKNOWN, "Unknown" },
+		{ MEMORY_ARRAY_LOCATION_SYSTEM_BOARD, "System Board Or Motherboard" },
+		{ MEMORY_ARRAY_LOCATION_ISA, "ISA Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_EISA, "EISA Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PCI, "PCI Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_MCA, "MCA Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PCMCIA, "PCMCIA Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PROPRIETARY, "Proprietary Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_NUBUS, "NuBus" },
+
+		{ MEMORY_ARRAY_LOCATION_PC98_C20, "PC-98/C20 Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PC98_C24, "PC-98/C24 Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PC98_E, "PC-98/E Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_PC98_LOCAL_BUS, "PC-98/Local Bus Add-on Card" },
+		{ MEMORY_ARRAY_LOCATION_CXL, "CXL Add-on Card" }
+	};
+
+	return FindEnumName<arrLocation>(nLocation);
+}
+
+constexpr const char* arrEventLogType[] =
+{
+	"Single-bit ECC memory error",
+	"Multi-bit ECC memory error",
+	"Parity memory error",
+	"Bus timeout",
+	"I/O channel block",
+	"Software NMI",
+	"POST memory resize",
+	"POST error",
+	"PCI parity error",
+	"PCI system error",
+	"CPU failure",
+	"EISA failsafe timer timeout",
+	"Correctable memory log disabled",
+	"Logging disabled",
+	"Reserved",
+	"System limit exceeded",
+	"Asynchronous hardware timer expired",
+	"System configuration information",
+	"Hard disk information",
+	"System reconfigured",
+	"Uncorrectable CPU-complex error",
+	"Log area reset/cleared",
+	"System boot"
+};
+
+constexpr const char* arrEventLogFormatType[] =
+{
+	"None",
+	"Handle",
+	"Multiple-event",
+	"Multiple-event handle",
+	"POST results bitmap",
+	"System management",
+	"Multiple-event system management"
+};
+
+// log header of type 1 format, at the header start offset of the log area
+struct EventLogHeaderType1_t
+{
+	std::uint8_t arrOEMReserved[5];
+	std::uint8_t nMultipleEventTimeWindow;
+	std::uint8_t nMultipleEventCountIncrement;
+	std::uint8_t uPreBootEventLogResetCMOSAddress;
+	std::uint8_t nPreBootEventLogResetCMOSBitIndex;
+	std::uint8_t uCMOSChecksumStartingOffset;
+	std::uint8_t nCMOSChecksumByteCount;
+	std::uint8_t uCMOSChecksumOffset;
+	std::uint8_t arrReserved[3];
+	std::uint8_t nHeaderRevision;
+};
+
+// beginning of the log record, that is followed by the variable data of the format given by the type descriptor
+struct EventLogRecordHeader_t
+{
+	std::uint8_t nLogType;
+	// bit 7 is set once the record has been read
+	std::uint8_t nLength;
+	// date and time in BCD, years 80-99 are of 20th century
+	std::uint8_t uYear;
+	std::uint8_t uMonth;
+	std::uint8_t uDay;
+	std::uint8_t uHour;
+	std::uint8_t uMinute;
+	std::uint8_t uSecond;
+};
+
+static const char* GetEventLogTypeName(const std::uint8_t nLogType)
+{
+	return nLogType == SMBIOS::EVENT_LOG_END ? "End of log" :
+		nLogType >= 0x80 ? "OEM Specific" :
+		nLogType == 0U || nLogType > Q_ARRAYSIZE(arrEventLogType) ? "Unused" :
+		arrEventLogType[nLogType - 1U];
+}
+
+static const char* GetEventLogFormatTypeName(const std::uint8_t nFormatType)
+{
+	return nFormatType >= 0x80 ? "OEM Specific" :
+		nFormatType >= Q_ARRAYSIZE(arrEventLogFormatType) ? "Unused" :
+		arrEventLogFormatType[nFormatType];
+}
+
+// @returns: type descriptor of the given index, which length is given by the structure, but is never less than the one defined
+static const SMBIOS::EventLogTypeDescriptor_t* GetEventLogTypeDescriptor(const SMBIOS::SystemEventLog_t* pSEL, const std::uint8_t nIndex)
+{
+	const std::size_t nDescriptorLength = std::max<std::size_t>(pSEL->nTypeDescriptorLength, sizeof(SMBIOS::EventLogTypeDescriptor_t));
+	return reinterpret_cast<const SMBIOS::EventLogTypeDescriptor_t*>(reinterpret_cast<const std::uint8_t*>(pSEL->arrTypeDescriptorsList) + nIndex * nDescriptorLength);
+}
+
+// description of the structure referenced by the handle
+struct HandleDescription_t
+{
+	char szValue[128];
+};
+
+/*
+ * describe the structure referenced by the handle with its type and, when available, the attribute that distinguish it from the other structures of the same type
+ * @returns: description formatted as " (Physical Memory Array, System Board Or Motherboard)", or an empty string if handle index isn't used or handle is not valid
+ */
+static HandleDescription_t DescribeHandle(const CHandleIndex* pHandleIndex, const std::uint16_t uHandle)
+{
+	HandleDescription_t description;
+	description.szValue[0] = '\0';
+
+	if (pHandleIndex == nullptr || uHandle == 0xFFFE || uHandle == Q_SMBIOS_HANDLE_INVALID)
+		return description;
+
+	const SMBIOS::StructureHeader_t* pStructure = pHandleIndex->Find(uHandle);
+	if (pStructure == nullptr)
+	{
+		std::snprintf(description.szValue, sizeof(description.szValue), " (Not Found)");
+		return description;
+	}
+
+	// strings of the referenced structure, that was found terminated by the boundary scan when indexed
+	CStringSet strings(pStructure);
+
+	const char* szAttribute = nullptr;
+	switch (pStructure->nType)
+	{
+	case SMBIOS::TYPE_BASEBOARD_INFORMATION:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::BaseboardInformation_t*>(pStructure->arrData)->nProduct).szValue;
+		break;
+	case SMBIOS::TYPE_PROCESSOR_INFORMATION:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::ProcessorInformation_t*>(pStructure->arrData)->nSocketDesignation).szValue;
+		break;
+	case SMBIOS::TYPE_MEMORY_MODULE_INFORMATION:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::MemoryModuleInformation_t*>(pStructure->arrData)->nSocketDesignation).szValue;
+		break;
+	case SMBIOS::TYPE_CACHE_INFORMATION:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::CacheInformation_t*>(pStructure->arrData)->nSocketDesignation).szValue;
+		break;
+	case SMBIOS::TYPE_SYSTEM_SLOTS:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::SystemSlots_t*>(pStructure->arrData)->nSlotDesignation).szValue;
+		break;
+	case SMBIOS::TYPE_PHYSICAL_MEMORY_ARRAY:
+		szAttribute = GetMemoryArrayLocationName(reinterpret_cast<const SMBIOS::PhysicalMemoryArray_t*>(pStructure->arrData)->nLocation);
+		break;
+	case SMBIOS::TYPE_MEMORY_DEVICE:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData)->nDeviceLocator).szValue;
+		break;
+	case SMBIOS::TYPE_ONBOARD_DEVICES_EXTENDED_INFORMATION:
+		szAttribute = strings.Get(reinterpret_cast<const SMBIOS::OnBoardDevicesExtendedInformation_t*>(pStructure->arrData)->nReferenceDesignation).szValue;
+		break;
+	default:
+		break;
+	}
+
+	if (szAttribute != nullptr)
+		std::snprintf(description.szValue, sizeof(description.szValue), " (%s, %s)", GetStructureTypeName(pStructure->nType), szAttribute);
+	else
+		std::snprintf(description.szValue, sizeof(description.szValue), " (%s)", GetStructureTypeName(pStructure->nType));
+
+	return description;
+}
+
+// offset and size of the structure member, for the field descriptors
+#define SMB_FIELD(STRUCT, MEMBER) SMB_FIELD_OFFSET(STRUCT, MEMBER), sizeof(STRUCT::MEMBER)
+
+constexpr const char* arrPointingDeviceType[] =
+{
+	"Other",
+	"Unknown",
+	"Mouse",
+	"Track Ball",
+	"Track Point",
+	"Glide Point",
+	"Touch Pad",
+	"Touch Screen",
+	"Optical Sensor"
+};
+
+constexpr EnumName_t arrPointingDeviceInterface[] =
+{
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_OTHER, "Other" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_UNKNOWN, "Unknown" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_SERIAL, "Serial" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_PS2, "PS/2" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_INFRARED, "Infrared" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_HP_HIL, "HP-HIL" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_BUS_MOUSE, "Bus Mouse" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_ADB, "ADB (Apple Desktop Bus)" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_BUS_MOUSE_DB9, "Bus Mouse DB-9" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_BUS_MOUSE_MICRO_DIN, "Bus Mouse micro-DIN" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_USB, "USB" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_I2C, "I2C" },
+	{ SMBIOS::POINTING_DEVICE_INTERFACE_SPI, "SPI" }
+};
+
+constexpr const char* arrBootOption[] =
+{
+	"Operating System",
+	"System Utilities",
+	"Do Not Reboot"
+};
+
+constexpr const char* arrSecurityStatus[] =
+{
+	"Disabled",
+	"Enabled",
+	"Not Implemented",
+	"Unknown"
+};
+
+constexpr EnumName_t arrCoolingDeviceType[] =
+{
+	{ SMBIOS::COOLING_DEVICE_OTHER, "Other" },
+	{ SMBIOS::COOLING_DEVICE_UNKNOWN, "Unknown" },
+	{ SMBIOS::COOLING_DEVICE_FAN, "Fan" },
+	{ SMBIOS::COOLING_DEVICE_CENTRIFUGAL_BLOWER, "Centrifugal Blower" },
+	{ SMBIOS::COOLING_DEVICE_CHIP_FAN, "Chip Fan" },
+	{ SMBIOS::COOLING_DEVICE_CABINET_FAN, "Cabinet Fan" },
+	{ SMBIOS::COOLING_DEVICE_POWER_SUPPLY_FAN, "Power Supply Fan" },
+	{ SMBIOS::COOLING_DEVICE_HEAT_PIPE, "Heat Pipe" },
+	{ SMBIOS::COOLING_DEVICE_INTEGRATED_REFRIGERATION, "Integrated Refrigeration" },
+	{ SMBIOS::COOLING_DEVICE_ACTIVE_COOLING, "Active Cooling" },
+	{ SMBIOS::COOLING_DEVICE_PASSIVE_COOLING, "Passive Cooling" }
+};
+
+constexpr const char* arrManagementDeviceType[] =
+{
+	"Other",
+	"Unknown",
+	"National Semiconductor LM75",
+	"National Semiconductor LM78",
+	"National Semiconductor LM79",
+	"National Semiconductor LM80",
+	"National Semiconductor LM81",
+	"Analog Devices ADM9240",
+	"Dallas Semiconductor DS1780",
+	"Maxim 1617",
+	"Genesys GL518SM",
+	"Winbond W83781D",
+	"Holtek HT82H791"
+};
+
+constexpr const char* arrManagementDeviceAddressType[] =
+{
+	"Other",
+	"Unknown",
+	"I/O Port",
+	"Memory",
+	"SMBus"
+};
+
+constexpr const char* arrPowerSupplyRangeSwitching[] =
+{
+	"Other",
+	"Unknown",
+	"Manual",
+	"Auto-Switch",
+	"Wide Range",
+	"N/A"
+};
+
+constexpr const char* arrPowerSupplyType[] =
+{
+	"Other",
+	"Unknown",
+	"Linear",
+	"Switching",
+	"Battery",
+	"UPS",
+	"Converter",
+	"Regulator"
+};
+
+constexpr EnumName_t arrStringPropertyIdentifier[] =
+{
+	{ 1U, "UEFI Device Path" }
+};
+
+// bit fields have no member offsets, so offsets of the integers that contain them are taken from the specification
+
+constexpr FieldDescriptor_t arrMemory32ErrorInformationFields[] =
+{
+	EnumField("Type", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, nType), arrMemoryErrorType, 1U),
+	EnumField("Granularity", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, nGranularity), arrMemoryErrorGranularity, 1U),
+	EnumField("Operation", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, nOperation), arrMemoryErrorOperation, 1U),
+	HexField("Vendor Syndrome", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, uVendorSyndrome), 8U).Special(0U, "Unknown"),
+	HexField("Array Error Address", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, uArrayErrorAddress), 8U).Special(0x80000000, "Unknown"),
+	HexField("Device Error Address", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, uDeviceErrorAddress), 8U).Special(0x80000000, "Unknown"),
+	HexField("Resolution", SMB_FIELD(SMBIOS::Memory32ErrorInformation_t, uResolution), 8U).Special(0x80000000, "Unknown")
+};
+
+constexpr FieldDescriptor_t arrBuiltinPointingDeviceFields[] =
+{
+	EnumField("Type", SMB_FIELD(SMBIOS::BuiltinPointingDevice_t, nType), arrPointingDeviceType, 1U),
+	SparseEnumField<arrPointingDeviceInterface>("Interface", SMB_FIELD(SMBIOS::BuiltinPointingDevice_t, nInterface)),
+	IntegerField("Buttons Count", SMB_FIELD(SMBIOS::BuiltinPointingDevice_t, nButtonsCount))
+};
+
+constexpr FieldDescriptor_t arrSystemResetFields[] =
+{
+	BooleanField("Status", 0x04, 1U, 0U),
+	EnumField("Boot Option", 0x04, 1U, arrBootOption, 1U).Bits(1U, 2U),
+	EnumField("Boot Option On Limit", 0x04, 1U, arrBootOption, 1U).Bits(3U, 2U),
+	BooleanField("Watchdog Timer", 0x04, 1U, 5U),
+	IntegerField("Reset Count", SMB_FIELD(SMBIOS::SystemReset_t, nResetCount)).Special(0xFFFF, "Unknown"),
+	IntegerField("Reset Limit", SMB_FIELD(SMBIOS::SystemReset_t, nResetLimit)).Special(0xFFFF, "Unknown"),
+	QuantityField("Timer Interval", SMB_FIELD(SMBIOS::SystemReset_t, uTimerInterval), "m").Special(0xFFFF, "Unknown"),
+	QuantityField("Timeout", SMB_FIELD(SMBIOS::SystemReset_t, uTimeout), "m").Special(0xFFFF, "Unknown")
+};
+
+constexpr FieldDescriptor_t arrHardwareSecurityFields[] =
+{
+	EnumField("Front Panel Reset Status", 0x04, 1U, arrSecurityStatus, 0U).Bits(0U, 2U),
+	EnumField("Administrator Password Status", 0x04, 1U, arrSecurityStatus, 0U).Bits(2U, 2U),
+	EnumField("Keyboard Password Status", 0x04, 1U, arrSecurityStatus, 0U).Bits(4U, 2U),
+	EnumField("Power On Password Status", 0x04, 1U, arrSecurityStatus, 0U).Bits(6U, 2U)
+};
+
+constexpr FieldDescriptor_t arrVoltageProbeFields[] =
+{
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::VoltageProbe_t, nDescription)),
+	EnumField("Location", 0x05, 1U, arrProbeLocation, 1U).Bits(0U, 5U),
+	EnumField("Status", 0x05, 1U, arrStatus, 1U).Bits(5U, 3U),
+	QuantityField("Max Value", SMB_FIELD(SMBIOS::VoltageProbe_t, uMaxValue), "mV").Special(0x8000, "Unknown"),
+	QuantityField("Min Value", SMB_FIELD(SMBIOS::VoltageProbe_t, uMinValue), "mV").Special(0x8000, "Unknown"),
+	QuantityField("Resolution", SMB_FIELD(SMBIOS::VoltageProbe_t, uResolution), "mV", 10U, 1U).Special(0x8000, "Unknown"),
+	QuantityField("Tolerance", SMB_FIELD(SMBIOS::VoltageProbe_t, uTolerance), "mV").Special(0x8000, "Unknown").EmptyZeroText(),
+	QuantityField("Accuracy", SMB_FIELD(SMBIOS::VoltageProbe_t, uAccuracy), "%", 100U, 2U).Special(0x8000, "Unknown"),
+	HexField("OEM Specific", SMB_FIELD(SMBIOS::VoltageProbe_t, uOemDefined), 8U),
+	QuantityField("Nominal Value", SMB_FIELD(SMBIOS::VoltageProbe_t, uNominalValue), "mV").Special(0x8000, "Unknown").Optional()
+};
+
+constexpr FieldDescriptor_t arrCoolingDeviceFields[] =
+{
+	HandleField("Temperature Probe Handle", SMB_FIELD_OFFSET(SMBIOS::CoolingDevice_t, uTemperatureProbeHandle)),
+	SparseEnumField<arrCoolingDeviceType>("Type", 0x06, 1U).Bits(0U, 5U),
+	EnumField("Status", 0x06, 1U, arrStatus, 1U).Bits(5U, 3U),
+	IntegerField("Cooling Unit Group", SMB_FIELD(SMBIOS::CoolingDevice_t, uCoolingUnitGroup)).Special(0U, "None"),
+	HexField("OEM Specific", SMB_FIELD(SMBIOS::CoolingDevice_t, uOemDefined), 8U),
+	QuantityField("Nominal Speed", SMB_FIELD(SMBIOS::CoolingDevice_t, uNominalSpeed), "RPM").Special(0x8000, "Unknown").Optional(),
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::CoolingDevice_t, nDescription)).Optional()
+};
+
+constexpr FieldDescriptor_t arrTemperatureProbeFields[] =
+{
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::TemperatureProbe_t, nDescription)),
+	EnumField("Location", 0x05, 1U, arrProbeLocation, 1U).Bits(0U, 5U),
+	EnumField("Status", 0x05, 1U, arrStatus, 1U).Bits(5U, 3U),
+	QuantityField("Max Value", SMB_FIELD(SMBIOS::TemperatureProbe_t, uMaxValue), "C", 10U, 1U).Special(0x8000, "Unknown"),
+	QuantityField("Min Value", SMB_FIELD(SMBIOS::TemperatureProbe_t, uMinValue), "C", 10U, 1U).Special(0x8000, "Unknown"),
+	QuantityField("Resolution", SMB_FIELD(SMBIOS::TemperatureProbe_t, uResolution), "C", 1000U, 3U).Special(0x8000, "Unknown"),
+	QuantityField("Tolerance", SMB_FIELD(SMBIOS::TemperatureProbe_t, uTolerance), "C", 10U, 1U).Special(0x8000, "Unknown"),
+	QuantityField("Accuracy", SMB_FIELD(SMBIOS::TemperatureProbe_t, uAccuracy), "%", 100U, 2U).Special(0x8000, "Unknown"),
+	HexField("OEM Specific", SMB_FIELD(SMBIOS::TemperatureProbe_t, uOemDefined), 8U),
+	QuantityField("Nominal Value", SMB_FIELD(SMBIOS::TemperatureProbe_t, uNominalValue), "C", 10U, 1U).Special(0x8000, "Unknown").Optional()
+};
+
+constexpr FieldDescriptor_t arrElectricalCurrentProbeFields[] =
+{
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::ElectricalCurrentProbe_t, nDescription)),
+	EnumField("Location", 0x05, 1U, arrProbeLocation, 1U).Bits(0U, 5U),
+	EnumField("Status", 0x05, 1U, arrStatus, 1U).Bits(5U, 3U),
+	QuantityField("Max Value", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uMaxValue), "mA").Special(0x8000, "Unknown"),
+	QuantityField("Min Value", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uMinValue), "mA").Special(0x8000, "Unknown"),
+	QuantityField("Resolution", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uResolution), "mA").Special(0x8000, "Unknown"),
+	QuantityField("Tolerance", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uTolerance), "mA", 10U, 1U).Special(0x8000, "Unknown"),
+	QuantityField("Accuracy", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uAccuracy), "%", 100U, 2U).Special(0x8000, "Unknown"),
+	HexField("OEM Specific", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uOemDefined), 8U),
+	QuantityField("Nominal Value", SMB_FIELD(SMBIOS::ElectricalCurrentProbe_t, uNominalValue), "mA").Special(0x8000, "Unknown").Optional()
+};
+
+constexpr FieldDescriptor_t arrOutOfBandRemoteAccessFields[] =
+{
+	StringField("Manufacturer", SMB_FIELD_OFFSET(SMBIOS::OutOfBandRemoteAccess_t, nManufacturer)),
+	BooleanField("Inbound Connection", 0x05, 1U, 0U),
+	BooleanField("Outbound Connection", 0x05, 1U, 1U)
+};
+
+constexpr FieldDescriptor_t arrMemory64ErrorInformationFields[] =
+{
+	EnumField("Type", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, nType), arrMemoryErrorType, 1U),
+	EnumField("Granularity", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, nGranularity), arrMemoryErrorGranularity, 1U),
+	EnumField("Operation", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, nOperation), arrMemoryErrorOperation, 1U),
+	HexField("Vendor Syndrome", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, uVendorSyndrome), 8U).Special(0U, "Unknown"),
+	HexField("Array Error Address", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, ullArrayErrorAddress), 16U).Special(0x8000'0000'0000'0000, "Unknown"),
+	HexField("Device Error Address", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, ullDeviceErrorAddress), 16U).Special(0x8000'0000'0000'0000, "Unknown"),
+	HexField("Resolution", SMB_FIELD(SMBIOS::Memory64ErrorInformation_t, uResolution), 8U).Special(0x80000000, "Unknown")
+};
+
+constexpr FieldDescriptor_t arrManagementDeviceFields[] =
+{
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::ManagementDevice_t, nDescription)),
+	EnumField("Type", SMB_FIELD(SMBIOS::ManagementDevice_t, nType), arrManagementDeviceType, 1U),
+	HexField("Address", SMB_FIELD(SMBIOS::ManagementDevice_t, uAddress), 8U),
+	EnumField("Address Type", SMB_FIELD(SMBIOS::ManagementDevice_t, nAddressType), arrManagementDeviceAddressType, 1U)
+};
+
+constexpr FieldDescriptor_t arrManagementDeviceComponentFields[] =
+{
+	StringField("Description", SMB_FIELD_OFFSET(SMBIOS::ManagementDeviceComponent_t, nDescription)),
+	HandleField("Device Handle", SMB_FIELD_OFFSET(SMBIOS::ManagementDeviceComponent_t, uDeviceHandle)),
+	HandleField("Component Handle", SMB_FIELD_OFFSET(SMBIOS::ManagementDeviceComponent_t, uComponentHandle)),
+	HandleField("Threshold Handle", SMB_FIELD_OFFSET(SMBIOS::ManagementDeviceComponent_t, uThresholdHandle))
+};
+
+// thresholds that aren't available are omitted
+constexpr FieldDescriptor_t arrManagementDeviceThresholdDataFields[] =
+{
+	IntegerField("Lower Non-Critical", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uLowerNonCritical)).Special(0x8000, nullptr),
+	IntegerField("Upper Non-Critical", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uUpperNonCritical)).Special(0x8000, nullptr),
+	IntegerField("Lower Critical", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uLowerCritical)).Special(0x8000, nullptr),
+	IntegerField("Upper Critical", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uUpperCritical)).Special(0x8000, nullptr),
+	IntegerField("Lower Non-Recoverable", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uLowerNonRecoverable)).Special(0x8000, nullptr),
+	IntegerField("Upper Non-Recoverable", SMB_FIELD(SMBIOS::ManagementDeviceThresholdData_t, uUpperNonRecoverable)).Special(0x8000, nullptr)
+};
+
+constexpr FieldDescriptor_t arrSystemPowerSupplyFields[] =
+{
+	IntegerField("Power Unit Group", SMB_FIELD(SMBIOS::SystemPowerSupply_t, uPowerUnitGroup)).Special(0U, "None"),
+	StringField("Location", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nLocation)),
+	StringField("Device Name", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nDeviceName)),
+	StringField("Manufacturer", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nManufacturer)),
+	StringField("Serial Number", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nSerialNumber)),
+	StringField("Asset Tag Number", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nAssetTagNumber)),
+	StringField("Model Part Number", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nModelPartNumber)),
+	StringField("Revision Level", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, nRevisionLevel)),
+	QuantityField("Max Power Capacity", SMB_FIELD(SMBIOS::SystemPowerSupply_t, uMaxPowerCapacity), "W", 1000U).Special(0x8000, "Unknown"),
+	BooleanField("Present", 0x0E, 2U, 1U),
+	BooleanField("Hot Replaceable", 0x0E, 2U, 0U),
+	BooleanField("Unplugged", 0x0E, 2U, 2U),
+	EnumField("Input Voltage Range Switching", 0x0E, 2U, arrPowerSupplyRangeSwitching, 1U).Bits(3U, 4U),
+	EnumField("Status", 0x0E, 2U, arrStatus, 1U).Bits(7U, 3U),
+	EnumField("Type", 0x0E, 2U, arrPowerSupplyType, 1U).Bits(10U, 4U),
+	HandleField("Input Voltage Probe Handle", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, uInputVoltageProbeHandle)),
+	HandleField("Cooling Device Handle", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, uCoolingDeviceHandle)),
+	HandleField("Input Current Probe Handle", SMB_FIELD_OFFSET(SMBIOS::SystemPowerSupply_t, uInputCurrentProbeHandle))
+};
+
+constexpr FieldDescriptor_t arrStringPropertyFields[] =
+{
+	SparseEnumField<arrStringPropertyIdentifier>("ID", SMB_FIELD(SMBIOS::StringProperty_t, uIdentifier)),
+	StringField("Value", SMB_FIELD_OFFSET(SMBIOS::StringProperty_t, nValue)),
+	HandleField("Parent Handle", SMB_FIELD_OFFSET(SMBIOS::StringProperty_t, uParentHandle))
+};
+
+#undef SMB_FIELD
+
+/*
+ * decode the single structure field from its descriptor, in the same way as the hand-written code does
+ * @remarks: descriptor is known at compile time, so only the code of its kind is instantiated
+ */
+template <const auto& arrFields, std::size_t nFieldIndex>
+static void DecodeField(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, CStringSet& strings, const CHandleIndex* pHandleIndex)
+{
+	constexpr const FieldDescriptor_t& field = arrFields[nFieldIndex];
+
+	if constexpr (field.nMinimumLength != 0U)
+	{
+		if (pStructure->nLength < field.nMinimumLength)
+			return;
+	}
+
+	const std::uint8_t* pFieldData = reinterpret_cast<const std::uint8_t*>(pStructure) + field.nOffset;
+	std::uint64_t ullValue;
+	if constexpr (field.nSize == 1U)
+		ullValue = *pFieldData;
+	else if constexpr (field.nSize == 2U)
+		ullValue = *reinterpret_cast<const std::uint16_t*>(pFieldData);
+	else if constexpr (field.nSize == 4U)
+		ullValue = *reinterpret_cast<const std::uint32_t*>(pFieldData);
+	else
+		ullValue = *reinterpret_cast<const std::uint64_t*>(pFieldData);
+
+	if constexpr (field.nBitCount != 0U)
+		ullValue = (ullValue >> field.nBitShift) & ((1ULL << field.nBitCount) - 1ULL);
+
+	if constexpr (field.bHasSpecialValue)
+	{
+		if (ullValue == field.ullSpecialValue)
+		{
+			if constexpr (field.szSpecialValue != nullptr)
+				emitter.Field(field.szLabel, field.szSpecialValue);
+
+			return;
+		}
+	}
+
+	if constexpr (field.nKind == FIELD_KIND_STRING)
+		emitter.Field(field.szLabel, strings.Get(ullValue));
+	else if constexpr (field.nKind == FIELD_KIND_INTEGER)
+		emitter.Field(field.szLabel, ullValue);
+	else if constexpr (field.nKind == FIELD_KIND_HEX)
+		emitter.HexField(field.szLabel, ullValue, field.nDigitCount);
+	else if constexpr (field.nKind == FIELD_KIND_QUANTITY)
+	{
+		if (field.bEmptyZeroText && ullValue == 0ULL && emitter.GetFormat() == OUTPUT_FORMAT_TEXT)
+			emitter.Field(field.szLabel, field.szUnit);
+		else if constexpr (field.nDigitCount == 0U)
+			emitter.Quantity(field.szLabel, ullValue / field.uDivisor, field.szUnit);
+		else
+			emitter.Quantity(field.szLabel, COutput::Fixed(static_cast<float>(ullValue) / static_cast<float>(field.uDivisor), field.nDigitCount), field.szUnit);
+	}
+	else if constexpr (field.nKind == FIELD_KIND_BOOLEAN)
+		emitter.Boolean(field.szLabel, ullValue != 0ULL);
+	else if constexpr (field.nKind == FIELD_KIND_ENUM)
+		emitter.Enum(field.szLabel, ullValue, (ullValue >= field.nNameBase && ullValue - field.nNameBase < field.nNameCount) ? field.arrNames[ullValue - field.nNameBase] : "Reserved");
+	else if constexpr (field.nKind == FIELD_KIND_SPARSE_ENUM)
+		emitter.Enum(field.szLabel, ullValue, field.fnFindName(static_cast<std::uint32_t>(ullValue), "Reserved"));
+	else if constexpr (field.nKind == FIELD_KIND_HANDLE)
+	{
+		const std::uint16_t uHandle = static_cast<std::uint16_t>(ullValue);
+		emitter.Handle(field.szLabel, uHandle, DescribeHandle(pHandleIndex, uHandle).szValue);
+	}
+}
+
+// decode all structure fields from their descriptors in order
+template <const auto& arrFields>
+static void DecodeFields(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, CStringSet& strings, const CHandleIndex* pHandleIndex)
+{
+	[&]<std::size_t... I>(std::index_sequence<I...>)
+	{
+		(DecodeField<arrFields, I>(emitter, pStructure, strings, pHandleIndex), ...);
+	}(std::make_index_sequence<std::size(arrFields)>{});
+}
+
+using StructureDecoder_t = void(*)(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, CStringSet& strings, const CHandleIndex* pHandleIndex);
+
+// structure types, that consist of the plain fields only, so they're decoded from the field descriptors
+constexpr struct { std::uint8_t nType; StructureDecoder_t fnDecode; } arrStructureDecoder[] =
+{
+	{ SMBIOS::TYPE_MEMORY_32BIT_ERROR_INFORMATION, &DecodeFields<arrMemory32ErrorInformationFields> },
+	{ SMBIOS::TYPE_BUILTIN_POINTING_DEVICE, &DecodeFields<arrBuiltinPointingDeviceFields> },
+	{ SMBIOS::TYPE_SYSTEM_RESET, &DecodeFields<arrSystemResetFields> },
+	{ SMBIOS::TYPE_HARDWARE_SECURITY, &DecodeFields<arrHardwareSecurityFields> },
+	{ SMBIOS::TYPE_VOLTAGE_PROBE, &DecodeFields<arrVoltageProbeFields> },
+	{ SMBIOS::TYPE_COOLING_DEVICE, &DecodeFields<arrCoolingDeviceFields> },
+	{ SMBIOS::TYPE_TEMPERATURE_PROBE, &DecodeFields<arrTemperatureProbeFields> },
+	{ SMBIOS::TYPE_ELECTRICAL_CURRENT_PROBE, &DecodeFields<arrElectricalCurrentProbeFields> },
+	{ SMBIOS::TYPE_OUTOFBAND_REMOTE_ACCESS, &DecodeFields<arrOutOfBandRemoteAccessFields> },
+	{ SMBIOS::TYPE_MEMORY_64BIT_ERROR_INFORMATION, &DecodeFields<arrMemory64ErrorInformationFields> },
+	{ SMBIOS::TYPE_MANAGEMENT_DEVICE, &DecodeFields<arrManagementDeviceFields> },
+	{ SMBIOS::TYPE_MANAGEMENT_DEVICE_COMPONENT, &DecodeFields<arrManagementDeviceComponentFields> },
+	{ SMBIOS::TYPE_MANAGEMENT_DEVICE_THRESHOLD_DATA, &DecodeFields<arrManagementDeviceThresholdDataFields> },
+	{ SMBIOS::TYPE_SYSTEM_POWER_SUPPLY, &DecodeFields<arrSystemPowerSupplyFields> },
+	{ SMBIOS::TYPE_STRING_PROPERTY, &DecodeFields<arrStringPropertyFields> }
+};
+
+// position of the structure decoder by the structure type, plus one, or zero if type is decoded by hand, for the constant time lookup
+constexpr std::array<std::uint8_t, 256U> arrStructureDecoderIndex = []()
+{
+	std::array<std::uint8_t, 256U> arrIndex = { };
+	for (std::size_t i = 0U; i < Q_ARRAYSIZE(arrStructureDecoder); ++i)
+		arrIndex[arrStructureDecoder[i].nType] = static_cast<std::uint8_t>(i + 1U);
+	return arrIndex;
+}();
+
+static void HandleStructure(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, CStringSet& strings, const std::uint32_t uVersion, const CHandleIndex* pHandleIndex)
+{
+	emitter.BeginStructure(pStructure, GetStructureTypeName(pStructure->nType));
+
+	if (const std::uint8_t nDecoderIndex = arrStructureDecoderIndex[pStructure->nType]; nDecoderIndex != 0U)
+	{
+		arrStructureDecoder[nDecoderIndex - 1U].fnDecode(emitter, pStructure, strings, pHandleIndex);
+		emitter.EndStructure();
+		return;
+	}
+
+	switch (pStructure->nType)
+	{
+	case SMBIOS::TYPE_PLATFORM_FIRMWARE_INFORMATION:
+	{
+		const auto pPFI = reinterpret_cast<const SMBIOS::PlatformFirmwareInformation_t*>(pStructure->arrData);
+		emitter.Field("Vendor", strings.Get(pPFI->nVendor));
+		emitter.Field("Firmware Version", strings.Get(pPFI->nFirmwareVersion));
+		emitter.HexField("Starting Address Segment", pPFI->uStartingAddressSegment, 2);
+		emitter.Field("Firmware Release Data", strings.Get(pPFI->nFirmwareReleaseDate));
+
+		std::uint32_t nFirmwareRomSize = pPFI->nFirmwareRomSize;
+		std::uint8_t nFirmwareRomSizeUnit = 0U;
+		if (nFirmwareRomSize == 0xFF && pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::PlatformFirmwareInformation_t, uEmbededControllerFirmwareMinorRelease) + 1U)
+		{
+			nFirmwareRomSize = pPFI->nExtendedFirmwareRomSize;
+			nFirmwareRomSizeUnit = pPFI->nExtendedFirmwareRomSizeUnit + 1U;
+		}
+		else
+			nFirmwareRomSize = (nFirmwareRomSize + 1U) * 64U;
+		emitter.Quantity("Firmware ROM Size", nFirmwareRomSize, arrSizeUnit[nFirmwareRomSizeUnit]);
+
+		constexpr const char* arrCharacteristics[] =
+		{
+			"Unknown",
+			"Not supported",
+			"ISA is supported",
+			"MCA is supported",
+			"EISA is supported",
+			"PCI is supported",
+			"PCMCIA is supported",
+			"Plug and Play is supported",
+			"APM",
+			"Firmware is upgradeable",
+			"Shadowing is allowed",
+			"VL-VESA is supported",
+			"ESCD is supported",
+			"Boot from CD is supported",
+			"Selectable boot is supported",
+			"Firmware ROM is socketed",
+			"Boot from PCMCIA is supported",
+			"EDD is supported",
+			"NEC 9800 3.5\" / 1.2M / 360RPM floppy is supported",
+			"Toshiba 3.5\" / 1.2M / 360RPM floppy is supported",
+			"5.25\" / 360KB floppy is supported",
+			"5.25\" / 1.2MB floppy is supported",
+			"3.5\" / 720KB floppy is supported",
+			"3.5\" / 2.88MB floppy is supported",
+			"Print screen service is supported",
+			"Keyboard services is supported",
+			"Serial services is supported",
+			"Printer services is supported",
+			"CGA/Mono Video services are supported",
+			"NEC PC-98"
+		};
+
+		emitter.BeginList("Firmware Characteristics");
+		for (std::uint64_t i = 2ULL; i <= 31ULL; ++i)
+		{
+			if (pPFI->ullFirmwareCharacteristics & (1ULL << i))
+				emitter.Item(arrCharacteristics[i - 2ULL]);
+		}
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::PlatformFirmwareInformation_t, uFirmwareCharacteristicsExtension1))
+			break;
+
+		constexpr const char* arrCharacteristicsExtension1[] =
+		{
+			"ACPI is supported",
+			"Legacy USB is supported",
+			"AGP is supported",
+			"I2O boot is supported",
+			"LS-120 boot is supported",
+			"ATAPI ZIP boot is supported",
+			"1394 boot is supported",
+			"Smart battery is supported",
+		};
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrCharacteristicsExtension1); ++i)
+		{
+			if (pPFI->uFirmwareCharacteristicsExtension1 & (1U << i))
+				emitter.Item(arrCharacteristicsExtension1[i]);
+		}
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::PlatformFirmwareInformation_t, uFirmwareCharacteristicsExtension2))
+			break;
+
+		constexpr const char* arrCharacteristicsExtension2[] =
+		{
+			"BIOS Boot Specification is supported",
+			"Function key-initiated network service boot is supported",
+			"Targeted content distribution is enabled",
+			"UEFI Specification is supported",
+			"Virtual machine",
+			"Manufacturing mode is supported",
+			"Manufacturing mode is enabled",
+			"Reserved"
+		};
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrCharacteristicsExtension2); ++i)
+		{
+			if (pPFI->uFirmwareCharacteristicsExtension2 & (1U << i))
+				emitter.Item(arrCharacteristicsExtension2[i]);
+		}
+		emitter.EndList();
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::PlatformFirmwareInformation_t, uPlatformFirmwareMajorRelease))
+			break;
+
+		emitter.Field("Platform Firmware Version", pPFI->uPlatformFirmwareMajorRelease, ".", pPFI->uPlatformFirmwareMinorRelease);
+		if (pPFI->uEmbededControllerFirmwareMajorRelease != 0xFF && pPFI->uEmbededControllerFirmwareMinorRelease != 0xFF)
+			emitter.Field("Embeded Controller Version", pPFI->uEmbededControllerFirmwareMajorRelease, ".", pPFI->uEmbededControllerFirmwareMinorRelease);
+		
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_INFORMATION:
+	{
+		const auto pSI = reinterpret_cast<const SMBIOS::SystemInformation_t*>(pStructure->arrData);
+		emitter.Field("Manufacturer", strings.Get(pSI->nManufacturer));
+		emitter.Field("Product", strings.Get(pSI->nProduct));
+		emitter.Field("Version", strings.Get(pSI->nVersion));
+		emitter.Field("Serial Number", strings.Get(pSI->nSerialNumber));
+		
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemInformation_t, arrUUID))
+			break;
+
+		emitter.Field("UUID", COutput::Hex(*reinterpret_cast<const std::uint32_t*>(pSI->arrUUID), 8), "-", COutput::Hex(*reinterpret_cast<const std::uint16_t*>(&pSI->arrUUID[4]), 4), "-", COutput::Hex(*reinterpret_cast<const std::uint16_t*>(&pSI->arrUUID[6]), 4), "-", COutput::Hex(*reinterpret_cast<const std::uint16_t*>(&pSI->arrUUID[8]), 4), "-", COutput::Hex(*reinterpret_cast<const std::uint32_t*>(&pSI->arrUUID[10]), 8), COutput::Hex(*reinterpret_cast<const std::uint16_t*>(&pSI->arrUUID[14]), 4));
+		
+		constexpr const char* arrWakeUpType[] =
+		{
+			"Reserved",
+			"Other",
+			"Unknown",
+			"APM Timer",
+			"Modem Ring",
+			"LAN Remote",
+			"Power Switch",
+			"PCI PME",
+			"Power Restored"
+		};
+		emitter.Enum("Wake Up Type", pSI->nWakeUpType, arrWakeUpType[pSI->nWakeUpType]);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemInformation_t, nSkuNumber))
+			break;
+
+		emitter.Field("SKU Number", strings.Get(pSI->nSkuNumber));
+		emitter.Field("Family", strings.Get(pSI->nFamily));
+		break;
+	}
+	case SMBIOS::TYPE_BASEBOARD_INFORMATION:
+	{
+		const auto pBI = reinterpret_cast<const SMBIOS::BaseboardInformation_t*>(pStructure->arrData);
+		emitter.Field("Manufacturer", strings.Get(pBI->nManufacturer));
+		emitter.Field("Product", strings.Get(pBI->nProduct));
+		emitter.Field("Version", strings.Get(pBI->nVersion));
+		emitter.Field("Serial Number", strings.Get(pBI->nSerialNumber));
+		emitter.Field("Asset Tag", strings.Get(pBI->nAssetTag));
+
+		constexpr const char* arrFeatureFlags[] =
+		{
+			"Hosting Board",
+			"Requires Daughter or Auxiliary Card",
+			"Removable",
+			"Replaceable",
+			"Hot-swappable"
+		};
+		emitter.BeginList("Feature Flags");
+		for (unsigned int i = 0U; i < 5U; ++i)
+		{
+			if (pBI->uFeatureFlags & (1U << i))
+				emitter.Item(arrFeatureFlags[i]);
+		}
+		emitter.EndList();
+		emitter.Enum("Board Type", pBI->nBoardType, arrBaseBoardType[pBI->nBoardType - 1U]);
+
+		emitter.BeginCountedList("Contained Object Handles", pBI->nContainedObjectHandleCount);
+		for (std::uint8_t i = 0U; i < pBI->nContainedObjectHandleCount; ++i)
+			emitter.NumberedHandle(i + 1U, pBI->arrContainedObjectHandles[i], DescribeHandle(pHandleIndex, pBI->arrContainedObjectHandles[i]).szValue);
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_ENCLOSURE:
+	{
+		const auto pSE = reinterpret_cast<const SMBIOS::SystemEnclosure_t*>(pStructure->arrData);
+
+		constexpr const char* arrChassisType[] =
+		{
+			"Other",
+			"Unknown",
+			"Desktop",
+			"Low Profile Desktop",
+			"Pizza Box",
+			"Mini Tower",
+			"Tower",
+			"Portable",
+			"Laptop",
+			"Notebook",
+			"Hand Held",
+			"Docking Station",
+			"All in One",
+			"Sub Notebook",
+			"Space-saving",
+			"Lunch Box",
+			"Main Server Chassis",
+			"Expansion Chassis",
+			"SubChassis",
+			"Bus Expansion Chassis",
+			"Peripheral Chassis",
+			"RAID Chassis",
+			"Rack Mount Chassis",
+			"Sealed-case PC",
+			"Multi-system Chassis",
+			"Compact PCI",
+			"Advanced TCA",
+			"Blade",
+			"Blade Enclosure",
+			"Tablet",
+			"Convertible",
+			"Detachable",
+			"IoT Gateway",
+			"Embedded PC",
+			"Mini PC",
+			"Stick PC"
+		};
+		emitter.Field("Manufacturer", strings.Get(pSE->nManufacturer));
+		emitter.Enum("Type", pSE->nChassisType, arrChassisType[pSE->nChassisType - 1U]);
+		emitter.Field("Version", strings.Get(pSE->nVersion));
+		emitter.Field("Serial Number", strings.Get(pSE->nSerialNumber));
+		emitter.Field("Asset Tag Number", strings.Get(pSE->nAssetTagNumber));
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemEnclosure_t, nBootUpState))
+			break;
+
+		constexpr const char* arrState[] =
+		{
+			"Other",
+			"Unknown",
+			"Safe",
+			"Warning",
+			"Critical",
+			"Non-recoverable"
+		};
+
+		constexpr const char* arrSecurityState[] =
+		{
+			"Other",
+			"Unknown",
+			"None",
+			"External interface locked out",
+			"External interface enabled"
+		};
+		emitter.Enum("Boot Up State", pSE->nBootUpState, arrState[pSE->nBootUpState - 1U]);
+		emitter.Enum("Power Supply State", pSE->nPowerSupplyState, arrState[pSE->nPowerSupplyState - 1U]);
+		emitter.Enum("Thermal State", pSE->nThermalState, arrState[pSE->nThermalState - 1U]);
+		emitter.Enum("Security Status", pSE->nSecurityStatus, arrSecurityState[pSE->nSecurityStatus - 1U]);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemEnclosure_t, uOemDefined))
+			break;
+
+		if (pSE->nHeight == 0U)
+			emitter.Field("Height", "None");
+		else
+			emitter.Quantity("Height", pSE->nHeight, "U");
+		if (pSE->nPowerCordsNumber == 0U)
+			emitter.Field("Power cords", "None");
+		else
+			emitter.Field("Power cords", pSE->nPowerCordsNumber);
+
+		// @test: it seems wrong?
+		emitter.BeginCountedList("Contained Elements", pSE->nContainedElementCount);
+		if (pSE->nContainedElementRecordLength >= sizeof(SMBIOS::EnclosureContainedElement_t))
+		{
+			for (std::uint8_t i = 0U; i < pSE->nContainedElementCount; ++i)
+			{
+				const SMBIOS::EnclosureContainedElement_t* pContainedElement = &pSE->arrContainedElements[i];
+				const char* szType = pContainedElement->nTypeSelect ? arrStructureType[pContainedElement->nType] : arrBaseBoardType[pContainedElement->nType - 1U];
+				if (pContainedElement->nMinCount == pContainedElement->nMaxCount)
+					emitter.NumberedItem(i + 1U, szType, ": ", pContainedElement->nMinCount);
+				else
+					emitter.NumberedItem(i + 1U, szType, ": ", pContainedElement->nMinCount, "-", pContainedElement->nMaxCount);
+			}
+		}
+		emitter.EndList();
+
+		const std::uint32_t nTotalContainedElementsSize = pSE->nContainedElementRecordLength * pSE->nContainedElementCount;
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemEnclosure_t, arrContainedElements) + nTotalContainedElementsSize)
+			break;
+
+		emitter.Field("SKU Number", strings.Get(*reinterpret_cast<const SMBIOS::StringIndex_t*>(reinterpret_cast<const std::uint8_t*>(pSE->arrContainedElements) + nTotalContainedElementsSize)));
+		break;
+	}
+	case SMBIOS::TYPE_PROCESSOR_INFORMATION:
+	{
+		const auto pPI = reinterpret_cast<const SMBIOS::ProcessorInformation_t*>(pStructure->arrData);
+
+		SMBIOS::ProcessorFamilyExtended_t nFamilyIndex = pPI->nFamily;
+		if (nFamilyIndex == SMBIOS::PROCESSOR_FAMILY_EXTENDED && pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nFamilyExtended))
+			nFamilyIndex = pPI->nFamilyExtended;
+		const char* szManufacturer = strings.Get(pPI->nManufacturer).szValue;
+
+		constexpr const char* arrType[] =
+		{
+			"Other",
+			"Unknown",
+			"Central Processor",
+			"Math Processor",
+			"DSP Processor",
+			"Video Processor"
+		};
+
+		using namespace SMBIOS;
+		static constexpr EnumName_t arrFamily[] =
+		{
+			{ PROCESSOR_FAMILY_OTHER, "Other" },
+			{ PROCESSOR_FAMILY_UNKNOWN, "Unknown" },
+			{ PROCESSOR_FAMILY_8086, "8086" },
+			{ PROCESSOR_FAMILY_80286, "80286" },
+			{ PROCESSOR_FAMILY_I386, "i386" },
+			{ PROCESSOR_FAMILY_I486, "i486" },
+			{ PROCESSOR_FAMILY_8087, "8087" },
+			{ PROCESSOR_FAMILY_80287, "80287" },
+			{ PROCESSOR_FAMILY_80387, "80387" },
+			{ PROCESSOR_FAMILY_80487, "80487" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM, "Pentium" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_PRO, "Pentium Pro" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_II, "Pentium II" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_MMX, "Pentium MMX" },
+			{ PROCESSOR_FAMILY_INTEL_CELERON, "Celeron" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_II_XEON, "Pentium II Xeon"},
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_III, "Pentium III" },
+			{ PROCESSOR_FAMILY_M1, "M1" },
+			{ PROCESSOR_FAMILY_M2, "M2" },
+			{ PROCESSOR_FAMILY_INTEL_CELERON_M, "Celeron M" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_4HT, "Pentium 4 HT" },
+			{ PROCESSOR_FAMILY_INTEL, "Intel" },
+
+			{ PROCESSOR_FAMILY_AMD_DURON, "Duron" },
+			{ PROCESSOR_FAMILY_AMD_K5, "K5" },
+			{ PROCESSOR_FAMILY_AMD_K6, "K6" },
+			{ PROCESSOR_FAMILY_AMD_K6_2, "K6-2" },
+			{ PROCESSOR_FAMILY_AMD_K6_3, "K6-3" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON, "Athlon" },
+			{ PROCESSOR_FAMILY_AMD_29000, "AMD29000" },
+			{ PROCESSOR_FAMILY_AMD_K6_2PLUS, "K6-2+" },
+			{ PROCESSOR_FAMILY_PPC, "Power PC" },
+			{ PROCESSOR_FAMILY_PPC_601, "Power PC 601" },
+			{ PROCESSOR_FAMILY_PPC_603, "Power PC 603" },
+			{ PROCESSOR_FAMILY_PPC_603PLUS, "Power PC 603+" },
+			{ PROCESSOR_FAMILY_PPC_604, "Power PC 604" },
+			{ PROCESSOR_FAMILY_PPC_620, "Power PC 620" },
+			{ PROCESSOR_FAMILY_PPC_X704, "Power PC x704" },
+			{ PROCESSOR_FAMILY_PPC_750, "Power PC 750" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_DUO, "Core Duo" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_DUO_MOBILE, "Core Duo Mobile" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_SOLO_MOBILE, "Core Solo Mobile" },
+			{ PROCESSOR_FAMILY_INTEL_ATOM, "Atom" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_M, "Core M" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_M3, "Core m3" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_M5, "Core m5" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_M7, "Core m7" },
+			{ PROCESSOR_FAMILY_ALPHA, "Alpha" },
+			{ PROCESSOR_FAMILY_ALPHA_21064, "Alpha 21064" },
+			{ PROCESSOR_FAMILY_ALPHA_21066, "Alpha 21066" },
+			{ PROCESSOR_FAMILY_ALPHA_21164, "Alpha 21164" },
+			{ PROCESSOR_FAMILY_ALPHA_21164PC, "Alpha 21164PC" },
+			{ PROCESSOR_FAMILY_ALPHA_21164A, "Alpha 21164a" },
+			{ PROCESSOR_FAMILY_ALPHA_21264, "Alpha 21264" },
+			{ PROCESSOR_FAMILY_ALPHA_21364, "Alpha 21364" },
+			{ PROCESSOR_FAMILY_AMD_TURION_II_ULTRA_MOBILE_M, "Turion II Ultra Dual-Core Mobile M" },
+			{ PROCESSOR_FAMILY_AMD_TURION_II_MOBILE_M, "Turion II Dual-Core Mobile M" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_II_M, "Athlon II Dual-Core M" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_6100, "Opteron 6100" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_4100, "Opteron 4100" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_6200, "Opteron 6200" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_4200, "Opteron 4200" },
+			{ PROCESSOR_FAMILY_AMD_FX, "FX" },
+			{ PROCESSOR_FAMILY_MIPS, "MIPS" },
+			{ PROCESSOR_FAMILY_MIPS_R4000, "MIPS R4000" },
+			{ PROCESSOR_FAMILY_MIPS_R4200, "MIPS R4200" },
+			{ PROCESSOR_FAMILY_MIPS_R4400, "MIPS R4400" },
+			{ PROCESSOR_FAMILY_MIPS_R4600, "MIPS R4600" },
+			{ PROCESSOR_FAMILY_MIPS_R10000, "MIPS R10000" },
+			{ PROCESSOR_FAMILY_AMD_C, "C-Series" },
+			{ PROCESSOR_FAMILY_AMD_E, "E-Series" },
+			{ PROCESSOR_FAMILY_AMD_A, "A-Series" },
+			{ PROCESSOR_FAMILY_AMD_G, "G-Series" },
+			{ PROCESSOR_FAMILY_AMD_Z, "Z-Series" },
+			{ PROCESSOR_FAMILY_AMD_R, "R-Series" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_4300, "Opteron 4300" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_6300, "Opteron 6300" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_3300, "Opteron 3300" },
+			{ PROCESSOR_FAMILY_AMD_FIREPRO, "FirePro" },
+			{ PROCESSOR_FAMILY_SPARC, "SPARC" },
+			{ PROCESSOR_FAMILY_SUPERSPARC, "SuperSPARC" },
+			{ PROCESSOR_FAMILY_MIRCOSPARC_II, "MicroSPARC II" },
+			{ PROCESSOR_FAMILY_MIRCOSPARC_IIEP, "MicroSPARC IIep" },
+			{ PROCESSOR_FAMILY_ULTRASPARC, "UltraSPARC" },
+			{ PROCESSOR_FAMILY_ULTRASPARC_II, "UltraSPARC II" },
+			{ PROCESSOR_FAMILY_ULTRASPARC_I2, "UltraSPARC Iii" },
+			{ PROCESSOR_FAMILY_ULTRASPARC_III, "UltraSPARC III" },
+			{ PROCESSOR_FAMILY_ULTRASPARC_III1, "UltraSPARC IIIi" },
+
+			{ PROCESSOR_FAMILY_68040, "68040" },
+			{ PROCESSOR_FAMILY_68XXX, "68XXX" },
+			{ PROCESSOR_FAMILY_68000, "68000" },
+			{ PROCESSOR_FAMILY_68010, "68010" },
+			{ PROCESSOR_FAMILY_68020, "68020" },
+			{ PROCESSOR_FAMILY_68030, "68030" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_X4_QUAD_CORE, "Athlon X4" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_X1000, "Opteron X1000" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_X2000, "Opteron X2000" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_A, "Opteron A-Series" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_X3000, "Opteron X3000" },
+			{ PROCESSOR_FAMILY_AMD_ZEN, "Zen" },
+
+			{ PROCESSOR_FAMILY_HOBBIT, "Hobbit" },
+
+			{ PROCESSOR_FAMILY_CRUSOE_TM5000, "Crusoe TM5000" },
+			{ PROCESSOR_FAMILY_CRUSOE_TM3000, "Crusoe TM3000" },
+			{ PROCESSOR_FAMILY_EFFICEON_TM8000, "Efficeon TM8000" },
+
+			{ PROCESSOR_FAMILY_WEITEK, "Weitek" },
+
+			{ PROCESSOR_FAMILY_ITANIUM, "Itanium" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_64, "Athlon 64" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON, "Opteron" },
+			{ PROCESSOR_FAMILY_AMD_SEMPRON, "Sempron" },
+			{ PROCESSOR_FAMILY_AMD_TURION_64_MOBILE, "Turion 64 Mobile" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_DUAL_CORE, "Dual-Core Opteron" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_64_X2_DUAL_CORE, "Athlon 64 X2" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_64_X2_MOBILE, "Turion 64 X2 Mobile" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_QUAD_CORE, "Opteron Quad-Core" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_GEN3, "Opteron Third-Generation" },
+			{ PROCESSOR_FAMILY_AMD_PHENOM_FX_QUAD_CORE, "Phenom FX Quad-Core" },
+			{ PROCESSOR_FAMILY_AMD_PHENOM_X4_QUAD_CORE, "Phenom X4 Quad-Core" },
+			{ PROCESSOR_FAMILY_AMD_PHENOM_X2_DUAL_CORE, "Phenom X2 Dual-Core" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_X2_DUAL_CORE, "Athlon X2 Dual-Core" },
+			{ PROCESSOR_FAMILY_PARISC, "PA-RISC" },
+			{ PROCESSOR_FAMILY_PARISC_8500, "PA-RISC 8500" },
+			{ PROCESSOR_FAMILY_PARISC_8000, "PA-RISC 8000" },
+			{ PROCESSOR_FAMILY_PARISC_7300LC, "PA-RISC 7300LC" },
+			{ PROCESSOR_FAMILY_PARISC_7200, "PA-RISC 7200" },
+			{ PROCESSOR_FAMILY_PARISC_7100LC, "PA-RISC 7100LC" },
+			{ PROCESSOR_FAMILY_PARISC_7100, "PA-RISC 7100" },
+
+			{ PROCESSOR_FAMILY_V30, "V30" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_3200, "Xeon Quad-Core 3200" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_3000, "Xeon Dual-Core 3000" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_5300, "Xeon Quad-Core 5300" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_5100, "Xeon Dual-Core 5100" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_5000, "Xeon Dual-Core 5000" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_LV, "Xeon Dual-Core LV" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_ULV, "Xeon Dual-Core ULV" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_7100, "Xeon Dual-Core 7100" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_5400, "Xeon Quad-Core 5400" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE, "Xeon Quad-Core" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_5200, "Xeon Dual-Core 5200" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_7200, "Xeon Dual-Core 7200" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_7300, "Xeon Quad-Core 7300" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_7400, "Xeon Quad-Core 7400" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_MULTI_CORE_7400, "Xeon Multi-Core 7400" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_III_XEON, "Pentium III Xeon" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_III_SPEEDSTEP, "Pentium III SpeedStep" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_4, "Pentium 4" },
+			{ PROCESSOR_FAMILY_INTEL_XEON, "Xeon" },
+			{ PROCESSOR_FAMILY_AS400, "AS400" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_MP, "Xeon MP" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_XP, "Athlon XP" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_MP, "Athlon MP" },
+			{ PROCESSOR_FAMILY_INTEL_ITANIUM_2, "Itanium 2" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_M, "Pentium M" },
+			{ PROCESSOR_FAMILY_INTEL_CELERON_D, "Celeron D" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_D, "Pentium D" },
+			{ PROCESSOR_FAMILY_INTEL_PENTIUM_EXTREME, "Pentium Extreme Edition" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_SOLO, "Core Solo" },
+			/* 0xBE handled as a special case */
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_DUO, "Core 2 Duo" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_SOLO, "Core 2 Solo" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_EXTREME, "Core 2 Extreme" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_QUAD, "Core 2 Quad" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_EXTREME_MOBILE, "Core 2 Extreme Mobile" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_DUO_MOBILE, "Core 2 Duo Mobile" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_2_SOLO_MOBILE, "Core 2 Solo Mobile" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_I7, "Core i7" },
+			{ PROCESSOR_FAMILY_INTEL_CELERON_DUAL_CORE, "Celeron Dual-Core" },
+			{ PROCESSOR_FAMILY_IBM390, "IBM390" },
+			{ PROCESSOR_FAMILY_G4, "G4" },
+			{ PROCESSOR_FAMILY_G5, "G5" },
+			{ PROCESSOR_FAMILY_G6_ESA390, "ESA/390 G6" },
+			{ PROCESSOR_FAMILY_ZARCHITECTURE, "z/Architecture" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_I5, "Core i5" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_I3, "Core i3" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_I9, "Core i9" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_D, "Xeon D" },
+
+			{ PROCESSOR_FAMILY_VIA_C7_M, "C7-M" },
+			{ PROCESSOR_FAMILY_VIA_C7_D, "C7-D" },
+			{ PROCESSOR_FAMILY_VIA_C7, "C7" },
+			{ PROCESSOR_FAMILY_VIA_EDEN, "Eden" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_MULTI_CORE, "Xeon Multi-Core" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_3XXX, "Xeon Dual-Core 3XXX" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_3XXX, "Xeon Quad-Core 3XXX" },
+			{ PROCESSOR_FAMILY_VIA_NANO, "Nano" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_5XXX, "Xeon Dual-Core 5XXX" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_5XXX, "Xeon Quad-Core 5XXX" },
+
+			{ PROCESSOR_FAMILY_INTEL_XEON_DUAL_CORE_7XXX, "Xeon Dual-Core 7XXX" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_QUAD_CORE_7XXX, "Xeon Quad-Core 7XXX" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_MULTI_CORE_7XXX, "Xeon Multi-Core 7XXX" },
+			{ PROCESSOR_FAMILY_INTEL_XEON_MULTI_CORE_3400, "Xeon Multi-Core 3400" },
+
+			{ PROCESSOR_FAMILY_AMD_OPTERON_3000, "Opteron 3000" },
+			{ PROCESSOR_FAMILY_AMD_SEMPRON_II, "Sempron II" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_QUAD_CORE_EMBEDDED, "Embedded Opteron Quad-Core" },
+			{ PROCESSOR_FAMILY_AMD_PHENOM_TRIPLE_CORE, "Phenom Triple-Core" },
+			{ PROCESSOR_FAMILY_AMD_TURION_ULTRA_DUAL_CORE, "Turion Ultra Dual-Core Mobile" },
+			{ PROCESSOR_FAMILY_AMD_TURION_DUAL_CORE_MOBILE, "Turion Dual-Core Mobile" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_DUAL_CORE, "Athlon Dual-Core" },
+			{ PROCESSOR_FAMILY_AMD_SEMPRON_SI, "Sempron SI" },
+			{ PROCESSOR_FAMILY_AMD_PHENOM_II, "Phenom II" },
+			{ PROCESSOR_FAMILY_AMD_ATHLON_II, "Athlon II" },
+			{ PROCESSOR_FAMILY_AMD_OPTERON_SIX_CORE, "Opteron Six-Core" },
+			{ PROCESSOR_FAMILY_AMD_SEMPRON_M, "Sempron M" },
+
+			{ PROCESSOR_FAMILY_I860, "i860" },
+			{ PROCESSOR_FAMILY_I960, "i960" },
+
+			{ PROCESSOR_FAMILY_ARMV7, "ARMv7" },
+			{ PROCESSOR_FAMILY_ARMV8, "ARMv8" },
+			{ PROCESSOR_FAMILY_ARMV9, "ARMv9" },
+			{ PROCESSOR_FAMILY_ARM_RESERVED, "ARM" },
+			{ PROCESSOR_FAMILY_SH3, "SH-3" },
+			{ PROCESSOR_FAMILY_SH4, "SH-4" },
+
+			{ PROCESSOR_FAMILY_ARM, "ARM" },
+			{ PROCESSOR_FAMILY_STRONGARM, "StrongARM" },
+
+			{ PROCESSOR_FAMILY_6X86, "6x86" },
+			{ PROCESSOR_FAMILY_MEDIAGX, "MediaGX" },
+			{ PROCESSOR_FAMILY_MII, "MII" },
+
+			{ PROCESSOR_FAMILY_WINCHIP, "WinChip" },
+			{ PROCESSOR_FAMILY_DSP, "DSP" },
+			{ PROCESSOR_FAMILY_VIDEO_PROCESSOR, "Video Processor" },
+
+			{ PROCESSOR_FAMILY_RV32, "RV32" },
+			{ PROCESSOR_FAMILY_RV64, "RV64" },
+			{ PROCESSOR_FAMILY_RV128, "RV128" },
+
+			{ PROCESSOR_FAMILY_LOONGARCH, "LoongArch" },
+			{ PROCESSOR_FAMILY_LOONGSON_1, "Loongson 1" },
+			{ PROCESSOR_FAMILY_LOONGSON_2, "Loongson 2" },
+			{ PROCESSOR_FAMILY_LOONGSON_3, "Loongson 3" },
+			{ PROCESSOR_FAMILY_LOONGSON_2K, "Loongson 2K" },
+			{ PROCESSOR_FAMILY_LOONGSON_3A, "Loongson 3A" },
+			{ PROCESSOR_FAMILY_LOONGSON_3B, "Loongson 3B" },
+			{ PROCESSOR_FAMILY_LOONGSON_3C, "Loongson 3C" },
+			{ PROCESSOR_FAMILY_LOONGSON_3D, "Loongson 3D" },
+			{ PROCESSOR_FAMILY_LOONGSON_3E, "Loongson 3E" },
+			{ PROCESSOR_FAMILY_LOONGSON_DUAL_CORE_2K_2XXX, "Loongson Dual-Core 2K 2XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_QUAD_CORE_3A_5XXX, "Loongson Quad-Core 3A 5XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_MULTI_CORE_3A_5XXX, "Loongson Multi-Core 3A 5XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_QUAD_CORE_3B_5XXX, "Loongson Quad-Core 3B 5XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_MULTI_CORE_3B_5XXX, "Loongson Multi-Core 3B 5XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_MULTI_CORE_3C_5XXX, "Loongson Multi-Core 3C 5XXX" },
+			{ PROCESSOR_FAMILY_LOONGSON_MULTI_CORE_3D_5XXX, "Loongson Multi-Core 3D 5XXX" },
+
+			{ PROCESSOR_FAMILY_INTEL_CORE_3, "Core 3" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_5, "Core 5" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_7, "Core 7" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_9, "Core 9" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_ULTRA_3, "Core Ultra 3" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_ULTRA_5, "Core Ultra 5" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_ULTRA_7, "Core Ultra 7" },
+			{ PROCESSOR_FAMILY_INTEL_CORE_ULTRA_9, "Core Ultra 9" }
+		};
+
+		const char* szFamily = "Reserved";
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, uL1CacheHandle) && nFamilyIndex == PROCESSOR_FAMILY_ALPHA && ::strstr(szManufacturer, "Intel") != nullptr)
+			szFamily = "Pentium Pro";
+		else if (nFamilyIndex == (PROCESSOR_FAMILY_INTEL_CORE_2 | PROCESSOR_FAMILY_AMD_K7))
+		{
+			if (::strstr(szManufacturer, "Intel") != nullptr)
+				szFamily = "Core 2";
+			else if (::strstr(szManufacturer, "AMD") != nullptr || ::strstr(szManufacturer, "Advanced Micro Devices") != nullptr)
+				szFamily = "K7";
+			else
+				szFamily = "Core 2 / K7";
+		}
+		else
+			szFamily = FindEnumName<arrFamily>(nFamilyIndex);
+		emitter.Field("Socket Designation", strings.Get(pPI->nSocketDesignation));
+		emitter.Enum("Type", pPI->nType, arrType[pPI->nType - 1U]);
+		emitter.Enum("Family", nFamilyIndex, szFamily);
+		emitter.Field("Manufacturer", szManufacturer);
+
+		emitter.Bytes("ID", pPI->arrProcessorID, sizeof(pPI->arrProcessorID));
+
+		// x86 processors store the CPUID signature in the ID, and ARM processors the main ID register, the others are left raw
+		ECpuVendor nVendor = CPU_VENDOR_UNKNOWN;
+		if (nFamilyIndex == SMBIOS::PROCESSOR_FAMILY_ARMV7 || nFamilyIndex == SMBIOS::PROCESSOR_FAMILY_ARMV8 || nFamilyIndex == SMBIOS::PROCESSOR_FAMILY_ARMV9 || nFamilyIndex == SMBIOS::PROCESSOR_FAMILY_ARM)
+			nVendor = CPU_VENDOR_ARM;
+		else if (szManufacturer != nullptr && ::strstr(szManufacturer, "Intel") != nullptr)
+			nVendor = CPU_VENDOR_INTEL;
+		else if (szManufacturer != nullptr && (::strstr(szManufacturer, "AMD") != nullptr || ::strstr(szManufacturer, "Advanced Micro Devices") != nullptr))
+			nVendor = CPU_VENDOR_AMD;
+		else if (szManufacturer != nullptr && ::strstr(szManufacturer, "Hygon") != nullptr)
+			nVendor = CPU_VENDOR_HYGON;
+
+		if (nVendor != CPU_VENDOR_UNKNOWN)
+		{
+			const CpuSignature_t signature = DecodeCpuSignature(nVendor, *reinterpret_cast<const std::uint32_t*>(pPI->arrProcessorID));
+			emitter.BeginGroup("Signature");
+			if (nVendor == CPU_VENDOR_ARM)
+			{
+				emitter.HexField("Implementer", signature.uImplementer, 2);
+				emitter.Field("Variant", signature.nVariant);
+				emitter.HexField("Architecture", signature.nArchitecture, 1);
+				emitter.HexField("Part Number", signature.uPartNumber, 3);
+				emitter.Field("Revision", signature.nRevision);
+			}
+			else
+			{
+				emitter.HexField("Family", signature.nFamily, 2);
+				emitter.HexField("Model", signature.nModel, 2);
+				emitter.Field("Stepping", signature.nStepping);
+			}
+			emitter.EndGroup();
+
+			const char* szMicroarchitecture = FindMicroarchitecture(signature);
+			emitter.Field("Microarchitecture", szMicroarchitecture != nullptr ? szMicroarchitecture : "Unknown");
+		}
+
+		emitter.Field("Version", strings.Get(pPI->nVersion));
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nSocketType))
+		{
+			if (pPI->bVoltageLegacyMode)
+				emitter.Quantity("Voltage", COutput::Fixed(static_cast<float>(pPI->uVoltageValue) / 10, 1), "V");
+			else
+			{
+				emitter.BeginInlineList("Voltage");
+				SMBIOS::VoltageFlags_t uVoltageFlags = pPI->uVoltageFlags;
+				for (std::uint8_t i = 0U; i < 3U; ++i)
+				{
+					if (uVoltageFlags & (1U << i))
+					{
+						uVoltageFlags &= ~(1U << i);
+						emitter.InlineItem(arrVoltage[i], uVoltageFlags != 0U ? '/' : '\n');
+					}
+				}
+				emitter.EndList();
+			}
+		}
+
+		if (pPI->uExternalClock == 0U)
+			emitter.Field("External Clock", "Unknown");
+		else
+			emitter.Quantity("External Clock", pPI->uExternalClock, "MHz");
+
+		if (pPI->uMaxSpeed == 0U)
+			emitter.Field("Max Speed (System Supported)", "Unknown");
+		else
+			emitter.Quantity("Max Speed (System Supported)", pPI->uMaxSpeed, "MHz");
+
+		emitter.Quantity("Current Speed (System Boot)", pPI->uCurrentSpeed, "MHz");
+
+		constexpr const char* arrActiveStatus[] =
+		{
+			"Unknown",
+			"Enabled",
+			"Disabled by User",
+			"Idle"
+		};
+
+		constexpr const char* arrUpgrade[] =
+		{
+			"Other",
+			"Unknown",
+			"Daugher Board",
+			"Socket ZIF",
+			"Replaceable Piggy Bank",
+			"None",
+			"Socket LIF",
+			"Slot 1",
+			"Slot 2",
+			"Socket 370-pin",
+			"Slot A",
+			"Slot M",
+			"Socket 423",
+			"Socket A",
+			"Socket 478",
+			"Socket 454",
+			"Socket 940",
+			"Socket 939",
+			"Socket mPGA604",
+			"Socket LGA771",
+			"Socket LGA775",
+			"Socket S1",
+			"Socket AM2",
+			"Socket F",
+			"Socket LGA1366",
+			"Socket G34",
+			"Socket AM3",
+			"Socket C32",
+			"Socket LGA1156",
+			"Socket LGA1567",
+			"Socket PGA988A",
+			"Socket BGA1288",
+			"Socket rPGA988B",
+			"Socket BGA1023",
+			"Socket BGA1224",
+			"Socket LGA1155",
+			"Socket LGA1356",
+			"Socket LGA2011",
+			"Socket FS1",
+			"Socket FS2",
+			"Socket FM1",
+			"Socket FM2",
+			"Socket LGA2011-3",
+			"Socket LGA1356-3",
+			"Socket LGA1150",
+			"Socket BGA1168",
+			"Socket BGA1234",
+			"Socket BGA1364",
+			"Socket AM4",
+			"Socket LGA1151",
+			"Socket BGA1356",
+			"Socket BGA1440",
+			"Socket BGA1515",
+			"Socket LGA3647-1",
+			"Socket SP3",
+			"Socket SP3r2",
+			"Socket LGA2066",
+			"Socket BGA1392",
+			"Socket BGA1510",
+			"Socket BGA1528",
+			"Socket LGA4189",
+			"Socket LGA1200",
+			"Socket LGA4677",
+			"Socket LGA1700",
+			"Socket BGA1744",
+			"Socket BGA1781",
+			"Socket BGA1211",
+			"Socket BGA2422",
+			"Socket LGA1211",
+			"Socket LGA2422",
+			"Socket LGA5773",
+			"Socket BGA5773",
+			"Socket AM5",
+			"Socket SP5",
+			"Socket SP6",
+			"Socket BGA883",
+			"Socket BGA1190",
+			"Socket BGA4129",
+			"Socket LGA4710",
+			"Socket LGA7529",
+			"Socket BGA1964",
+			"Socket BGA1792",
+			"Socket BGA2049",
+			"Socket BGA2551",
+			"Socket LGA1851",
+			"Socket BGA2114",
+			"Socket BGA2833",
+		};
+
+		emitter.Enum("Status", pPI->nStatus, arrActiveStatus[pPI->nStatus]);
+		emitter.Field("Socket", pPI->bSocketPopulated ? "Populated" : "Unpopulated");
+		
+		if (pPI->nUpgrade != PROCESSOR_UPGRADE_WILDCARD)
+			emitter.Enum("Upgrade", pPI->nUpgrade, arrUpgrade[pPI->nUpgrade - 1U]);
+		else if (pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nSocketType))
+			emitter.Field("Socket Type", strings.Get(pPI->nSocketType));
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, uL1CacheHandle))
+			break;
+
+		emitter.Handle("L1 Cache Handle", pPI->uL1CacheHandle, DescribeHandle(pHandleIndex, pPI->uL1CacheHandle).szValue);
+		emitter.Handle("L2 Cache Handle", pPI->uL2CacheHandle, DescribeHandle(pHandleIndex, pPI->uL2CacheHandle).szValue);
+		emitter.Handle("L3 Cache Handle", pPI->uL3CacheHandle, DescribeHandle(pHandleIndex, pPI->uL3CacheHandle).szValue);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nSerialNumber))
+			break;
+
+		emitter.Field("Serial Number", strings.Get(pPI->nSerialNumber));
+		emitter.Field("Asset Tag", strings.Get(pPI->nAssetTag));
+		emitter.Field("Part Number", strings.Get(pPI->nPartNumber));
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nCoreCount))
+			break;
+
+		constexpr const char* arrCharacteristics[] =
+		{
+			"Unknown",
+			"64-bit Capable",
+			"Multi-Core",
+			"Hardware Thread",
+			"Execute Protection",
+			"Enhanced Virtualization",
+			"Power/Performance Control",
+			"128-bit Capable",
+			"ARM64 SoC ID",
+		};
+		emitter.BeginList("Characteristics");
+		for (std::uint16_t i = 1U; i < 9U; ++i)
+		{
+			if (pPI->uCharacteristics & (1U << i))
+				emitter.Item(arrCharacteristics[i - 1U]);
+		}
+		emitter.EndList();
+
+		std::uint16_t nCoreCount = pPI->nCoreCount;
+
+		std::uint16_t nCoreEnabled = pPI->nCoreEnabled;
+		std::uint16_t nThreadCount = pPI->nThreadCount;
+
+		if (pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nCoreCountExtended))
+		{
+			if (nCoreCount == 0xFF)
+				nCoreCount = pPI->nCoreCountExtended;
+			if (nCoreEnabled == 0xFF)
+				nCoreEnabled = pPI->nCoreEnabledExtended;
+			if (nThreadCount == 0xFF)
+				nThreadCount = pPI->nThreadCountExtended;
+		}
+
+		if (nCoreCount == 0U)
+			emitter.Field("Core Count", "Unknown");
+		else
+			emitter.Field("Core Count", nCoreCount);
+		
+		if (nCoreEnabled == 0U)
+			emitter.Field("Core Enabled", "Unknown");
+		else
+			emitter.Field("Core Enabled", nCoreEnabled);
+
+		if (nThreadCount == 0U)
+			emitter.Field("Thread Count", "Unknown");
+		else
+			emitter.Field("Thread Count", nThreadCount);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::ProcessorInformation_t, nThreadEnabled))
+			break;
+
+		emitter.Field("Thread Enabled", pPI->nThreadEnabled);
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_CONTROLLER_INFORMATION:
+	{
+		const auto pMCI = reinterpret_cast<const SMBIOS::MemoryControllerInformation_t*>(pStructure->arrData);
+
+		constexpr const char* arrErrorDetectingMethod[] =
+		{
+			"Other",
+			"Unknown",
+			"None",
+			"8-bit Parity",
+			"32-bit ECC",
+			"64-bit ECC",
+			"128-bit ECC",
+			"CRC",
+		};
+		emitter.Enum("Error Detecting Method", pMCI->nErrorDetectingMethod, arrErrorDetectingMethod[pMCI->nErrorDetectingMethod - 1U]);
+		emitter.BeginList("Error Correcting Capability");
+		
+		constexpr const char* arrErrorCorrectingCapability[] =
+		{
+			"Other",
+			"Unknown",
+			"None",
+			"Single-bit",
+			"Double-bit",
+			"Scrubbing"
+		};
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrErrorCorrectingCapability); ++i)
+		{
+			if (pMCI->uErrorCorrectingCapability & (1U << i))
+				emitter.Item(arrErrorCorrectingCapability[i]);
+		}
+		emitter.EndList();
+
+		constexpr const char* arrInterleaveSupportType[] =
+		{
+			"Other",
+			"Unknown",
+			"One-Way",
+			"Two-Way",
+			"Four-Way",
+			"Eight-Way",
+			"Sixteen-Way"
+		};
+		emitter.Enum("Supported Interleave", pMCI->nSupportedInterleave, arrInterleaveSupportType[pMCI->nSupportedInterleave - 1U]);
+		emitter.Enum("Current Interleave", pMCI->nCurrentInterleave, arrInterleaveSupportType[pMCI->nCurrentInterleave - 1U]);
+		emitter.Quantity("Max Memory Module Size", 1ULL << pMCI->nMaxMemoryModuleSize, "MiB");
+		emitter.Quantity("Max Total Memory Size", (1ULL << pMCI->nMaxMemoryModuleSize) * pMCI->nAssociatedMemorySlotsCount, "MiB");
+		emitter.BeginList("Supported Speeds");
+		
+		constexpr const char* arrSupportedSpeed[] =
+		{
+			"Other",
+			"Unknown",
+			"70ns",
+			"60ns",
+			"50ns"
+		};
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrSupportedSpeed); ++i)
+		{
+			if (pMCI->uSupportedSpeeds & (1U << i))
+				emitter.Item(arrSupportedSpeed[i]);
+		}
+		emitter.EndList();
+		
+		emitter.BeginList("Supported Types");
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrMemoryType); ++i)
+		{
+			if (pMCI->uSupportedTypes & (1U << i))
+				emitter.Item(arrMemoryType[i]);
+		}
+		emitter.EndList();
+
+		emitter.BeginInlineList("Voltage");
+		SMBIOS::VoltageFlags_t uVoltageFlags = pMCI->uMemoryModuleVoltage;
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrVoltage); ++i)
+		{
+			if (uVoltageFlags & (1U << i))
+			{
+				uVoltageFlags &= ~(1U << i);
+				emitter.InlineItem(arrVoltage[i], uVoltageFlags != 0U ? '/' : '\n');
+			}
+		}
+		emitter.EndList();
+
+		emitter.BeginCountedList("Associated Memory Slots", pMCI->nAssociatedMemorySlotsCount);
+		for (std::uint8_t i = 0U; i < pMCI->nAssociatedMemorySlotsCount; ++i)
+			emitter.NumberedHandle(i + 1U, pMCI->arrMemoryModuleConfigurationHandles[i], DescribeHandle(pHandleIndex, pMCI->arrMemoryModuleConfigurationHandles[i]).szValue);
+		emitter.EndList();
+
+		const std::uint32_t nTotalAssociatedMemorySlotsSize = sizeof(std::uint16_t) * pMCI->nAssociatedMemorySlotsCount;
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryControllerInformation_t, arrMemoryModuleConfigurationHandles) + nTotalAssociatedMemorySlotsSize)
+			break;
+
+		const auto uEnabledErrorCorrectingCapabilites = *reinterpret_cast<const SMBIOS::MemoryControllerErrorCorrectingCapability_t*>(pStructure->arrData + Q_OFFSETOF(SMBIOS::MemoryControllerInformation_t, arrMemoryModuleConfigurationHandles) + nTotalAssociatedMemorySlotsSize);
+		emitter.BeginList("Enabled Error Correcting Capabilities");
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrErrorCorrectingCapability); ++i)
+		{
+			if (uEnabledErrorCorrectingCapabilites & (1U << i))
+				emitter.Item(arrErrorCorrectingCapability[i]);
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_MODULE_INFORMATION:
+	{
+		const auto pMMI = reinterpret_cast<const SMBIOS::MemoryModuleInformation_t*>(pStructure->arrData);
+		emitter.Field("Socket Designation", strings.Get(pMMI->nSocketDesignation));
+
+		if (pMMI->uBankConnections == 0xFF)
+			emitter.Field("Bank Connections", "None");
+		else
+		{
+			emitter.BeginInlineList("Bank Connections");
+			if ((pMMI->uBankConnections & 0xF0) == 0xF0)
+				emitter.InlineItem(pMMI->uBankConnections >> 4U);
+			else if ((pMMI->uBankConnections & 0x0F) == 0x0F)
+				emitter.InlineItem(pMMI->uBankConnections & 0x0F);
+			else
+			{
+				emitter.InlineItem(pMMI->uBankConnections >> 4U, ' ');
+				emitter.InlineItem(pMMI->uBankConnections & 0x0F);
+			}
+			emitter.EndList();
+		}
+
+		if (pMMI->uCurrentSpeed != 0U)
+			emitter.Quantity("Current Speed", pMMI->uCurrentSpeed, "ns");
+		else
+			emitter.Field("Current Speed", "Unknown");
+
+		emitter.BeginList("Current Memory Type");
+		for (std::uint8_t i = 0U; i < Q_ARRAYSIZE(arrMemoryType); ++i)
+		{
+			if (pMMI->uCurrentMemoryType & (1U << i))
+				emitter.Item(arrMemoryType[i]);
+		}
+		emitter.EndList();
+
+		// @test: not sure as it isn't clear could installed has Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_ENABLED value?
+		if (pMMI->nInstalledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_DETERMINABLE ||
+			pMMI->nInstalledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_INSTALLED)
+			emitter.Field("Installed Size", pMMI->nInstalledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_DETERMINABLE ? "Not Determinable" : "Not Installed");
+		else
+			emitter.Field("Installed Size", 1ULL << pMMI->nInstalledSize, "MiB (", pMMI->bInstalledDoubleBank ? "Double-Bank" : "Single-Bank", ")");
+
+		// @test: not sure as it isn't clear could enabled has Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_DETERMINABLE value?
+		if (pMMI->nEnabledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_ENABLED ||
+			pMMI->nEnabledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_INSTALLED)
+			emitter.Field("Enabled Size", pMMI->nEnabledSize == Q_SMBIOS_MEMORY_MODULE_SIZE_NOT_ENABLED ? "Not Enabled" : "Not Installed");
+		else
+			emitter.Field("Enabled Size", 1ULL << pMMI->nEnabledSize, "MiB (", pMMI->bEnabledDoubleBank ? "Double-Bank" : "Single-Bank", ")");
+
+		constexpr const char* arrErrorStatus[] =
+		{
+			"OK",
+			"Uncorrectable",
+			"Correctable",
+			"Uncorrectable & Correctable"
+		};
+		emitter.Field("Error Status", (pMMI->uErrorStatus& Q_SMBIOS_MEMORY_MODULE_ERROR_LOG) ? "Event Log" : arrErrorStatus[pMMI->uErrorStatus]);
+		break;
+	}
+	case SMBIOS::TYPE_CACHE_INFORMATION:
+	{
+		const auto pCI = reinterpret_cast<const SMBIOS::CacheInformation_t*>(pStructure->arrData);
+		emitter.Field("Socket Designation", strings.Get(pCI->nSocketDesignation));
+
+		constexpr const char* arrLocation[] =
+		{
+			"Internal",
+			"External",
+			"Reserved",
+			"Unknown"
+		};
+		constexpr const char* arrOperationalMode[] =
+		{
+			"Write Through",
+			"Write Back",
+			"Varies with Memory Address",
+			"Unknown"
+		};
+		emitter.BeginGroup("Configuration");
+		emitter.Field("Level", pCI->nLevel);
+		emitter.Boolean("Socketed", pCI->bSocketed, " true");
+		emitter.Enum("Location", pCI->nLocation, arrLocation[pCI->nLocation]);
+		emitter.Enum("Operational Mode", pCI->nOperationalMode, arrOperationalMode[pCI->nOperationalMode]);
+		emitter.EndGroup();
+
+		if (pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::CacheInformation_t, nAssociativity) + 1U)
+		{
+			const std::uint64_t nMaxSizeKiB = (pCI->nMaxSizeExtendedGranularity ? (pCI->nMaxSizeExtended * 64U) : pCI->nMaxSizeExtended);
+			const std::uint64_t nInstalledSizeKiB = (pCI->nInstalledSizeExtendedGranularity ? (pCI->nInstalledSizeExtended * 64U) : pCI->nInstalledSizeExtended);
+			emitter.Quantity("Max Size", nMaxSizeKiB >= 1024U ? nMaxSizeKiB / 1024U : nMaxSizeKiB, arrSizeUnit[nMaxSizeKiB >= 1024U]);
+			emitter.Quantity("Installed Size", nInstalledSizeKiB >= 1024U ? nInstalledSizeKiB / 1024U : nInstalledSizeKiB, arrSizeUnit[nInstalledSizeKiB >= 1024U]);
+		}
+		else
+		{
+			const std::uint32_t nMaxSizeKiB = (pCI->nMaxSizeGranularity ? (pCI->nMaxSize * 64U) : pCI->nMaxSize);
+			const std::uint32_t nInstalledSizeKiB = (pCI->nInstalledSizeGranularity ? (pCI->nInstalledSize * 64U) : pCI->nInstalledSize);
+			emitter.Quantity("Max Size", nMaxSizeKiB >= 1024U ? nMaxSizeKiB / 1024U : nMaxSizeKiB, arrSizeUnit[nMaxSizeKiB >= 1024U]);
+			emitter.Quantity("Installed Size", nInstalledSizeKiB >= 1024U ? nInstalledSizeKiB / 1024U : nInstalledSizeKiB, arrSizeUnit[nInstalledSizeKiB >= 1024U]);
+		}
+
+		constexpr const char* arrSRAMType[] =
+		{
+			"Other",
+			"Unknown",
+			"Non-Burst",
+			"Burst",
+			"Pipeline Burst",
+			"Synchronous",
+			"Asynchronous"
+		};
+		emitter.BeginList("Supported SRAM Type");
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrSRAMType); ++i)
+		{
+			if (pCI->uSupportedSRAMType & (1U << i))
+				emitter.Item(arrSRAMType[i]);
+		}
+		emitter.EndList();
+
+		emitter.BeginList("Current SRAM Type");
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrSRAMType); ++i)
+		{
+			if (pCI->uCurrentSRAMType & (1U << i))
+				emitter.Item(arrSRAMType[i]);
+		}
+		emitter.EndList();
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::CacheInformation_t, uSpeed))
+			break;
+
+		if (pCI->uSpeed != 0U)
+			emitter.Quantity("Speed", pCI->uSpeed, "ns");
+		else
+			emitter.Field("Speed", "Unknown");
+
+		constexpr const char* arrErrorCorrectionType[] =
+		{
+			"Other",
+			"Unknown",
+			"None",
+			"Parity",
+			"Single-bit ECC",
+			"Multi-bit ECC",
+		};
+		constexpr const char* arrSystemCacheType[] =
+		{
+			"Other",
+			"Unknown",
+			"Instruction",
+			"Data",
+			"Unified"
+		};
+		constexpr const char* arrAssociativity[] =
+		{
+			"Other",
+			"Unknown",
+			"Direct Mapped",
+			"2-way Set",
+			"4-way Set",
+			"Fully",
+			"8-way Set",
+			"16-way Set",
+			"12-way Set",
+			"24-way Set",
+			"32-way Set",
+			"48-way Set",
+			"64-way Set",
+			"20-way Set"
+		};
+		emitter.Enum("Error Correction Type", pCI->nErrorCorrectionType, arrErrorCorrectionType[pCI->nErrorCorrectionType - 1U]);
+		emitter.Enum("System Cache Type", pCI->nSystemCacheType, arrSystemCacheType[pCI->nSystemCacheType - 1U]);
+		emitter.Enum("Associativity", pCI->nAssociativity, arrAssociativity[pCI->nAssociativity - 1U]);
+		break;
+	}
+	case SMBIOS::TYPE_PORT_CONNECTOR_INFORMATION:
+	{
+		const auto pPCI = reinterpret_cast<const SMBIOS::PortConnectorInformation_t*>(pStructure->arrData);
+
+		constexpr const char* arrConnectorType[] =
+		{
+			"None",
+			"Centronics",
+			"Mini Centronics",
+			"Proprietary",
+			"DB-25 male",
+			"DB-25 female",
+			"DB-15 male",
+			"DB-15 female",
+			"DB-9 male",
+			"DB-9 female",
+			"RJ-11",
+			"RJ-45",
+			"50-pin MiniSCSI",
+			"Mini-DIN",
+			"Micro-DIN",
+			"PS/2",
+			"Infrared",
+			"HP-HIL",
+			"Access Bus (USB)",
+			"SSA SCSI",
+			"Circular DIN-8 male",
+			"Circular DIN-8 female",
+			"On Board IDE",
+			"On Board Floppy",
+			"9-pin Dual Inline (pin 10 cut)",
+			"25-pin Dual Inline (pin 26 cut)",
+			"50-pin Dual Inline",
+			"68-pin Dual Inline",
+			"On Board Sound Input From CD-ROM",
+			"Mini-Centronics Type-14",
+			"Mini-Centronics Type-26",
+			"Mini-Jack (headphones)",
+			"BNC",
+			"IEEE 1394",
+			"SAS/SATA Plug Receptacle",
+			"USB Type-C Receptacle"
+		};
+
+		constexpr const char* arrConnectorExtraType[] =
+		{
+			"PC-98",
+			"PC-98Hireso",
+			"PC-H98",
+			"PC-98Note",
+			"PC-98Full"
+		};
+		
+		constexpr const char* arrPortType[] =
+		{
+			"None",
+			"Parallel Port XT/AT Compatible",
+			"Parallel Port PS/2",
+			"Parallel Port ECP",
+			"Parallel Port EPP",
+			"Parallel Port ECP/EPP",
+			"Serial Port XT/AT Compatible",
+			"Serial Port 16450 Compatible",
+			"Serial Port 16550 Compatible",
+			"Serial Port 16550A Compatible",
+			"SCSI Port",
+			"MIDI Port",
+			"Joystick Port",
+			"Keyboard Port",
+			"Mouse Port",
+			"SSA SCSI",
+			"USB",
+			"FireWire (IEEE P1394)",
+			"PCMCIA Type I",
+			"PCMCIA Type II",
+			"PCMCIA Type III",
+			"Card bus",
+			"Access Bus Port",
+			"SCSI II",
+			"SCSI Wide",
+			"PC-98",
+			"PC-98 Hireso",
+			"PC-H98",
+			"Video Port",
+			"Audio Port",
+			"Modem Port",
+			"Network Port",
+			"SATA",
+			"SAS",
+			"MFDP (Multi-Function Display Port)",
+			"Thunderbolt"
+		};
+
+		constexpr const char* arrPortExtraType[] =
+		{
+			"8251 Compatible",
+			"8251 FIFO Compatible"
+		};
+
+		emitter.Field("Internal Reference Designator", strings.Get(pPCI->nInternalReferenceDesignator));
+		emitter.Enum("Internal Connector Type", pPCI->nInternalConnectorType, pPCI->nInternalConnectorType == SMBIOS::PORT_CONNECTOR_OTHER ?
+				strings.Get(pPCI->nInternalReferenceDesignator).szValue :
+				(pPCI->nInternalConnectorType >= SMBIOS::PORT_CONNECTOR_PC_98) ?
+					arrConnectorExtraType[pPCI->nInternalConnectorType - SMBIOS::PORT_CONNECTOR_PC_98] :
+					arrConnectorType[pPCI->nInternalConnectorType]);
+		emitter.Field("External Reference Designator", strings.Get(pPCI->nExternalReferenceDesignator));
+		emitter.Enum("External Connector Type", pPCI->nExternalConnectorType, pPCI->nExternalConnectorType == SMBIOS::PORT_CONNECTOR_OTHER ?
+				strings.Get(pPCI->nExternalReferenceDesignator).szValue :
+				(pPCI->nExternalConnectorType >= SMBIOS::PORT_CONNECTOR_PC_98) ?
+					arrConnectorExtraType[pPCI->nInternalConnectorType - SMBIOS::PORT_CONNECTOR_PC_98] :
+					arrConnectorType[pPCI->nExternalConnectorType]);
+		emitter.Enum("Port Type", pPCI->nPortType, pPCI->nPortType == SMBIOS::PORT_OTHER ? "Other" :
+				pPCI->nPortType >= SMBIOS::PORT_8251_COMPATIBLE ?
+					arrPortExtraType[pPCI->nPortType - SMBIOS::PORT_8251_COMPATIBLE] :
+					arrPortType[pPCI->nPortType]);
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_SLOTS:
+	{
+		const auto pSS = reinterpret_cast<const SMBIOS::SystemSlots_t*>(pStructure->arrData);
+
+		using namespace SMBIOS;
+		static constexpr EnumName_t arrSlotTypes[] =
+		{
+			{ SLOT_OTHER, "Other" },
+			{ SLOT_UNKNOWN, "Unknown" },
+			{ SLOT_ISA, "ISA" },
+			{ SLOT_MCA, "MCA" },
+			{ SLOT_EISA, "EISA" },
+			{ SLOT_PCI, "PCI" },
+			{ SLOT_PCMCIA, "PC Card (PCMCIA)" },
+			{ SLOT_VLVESA, "VL-VESA" },
+			{ SLOT_PROPRIETARY, "Proprietary" },
+			{ SLOT_PROCESSOR_CARD, "Processor Card" },
+			{ SLOT_PROPRIETARY_MEMORY_CARD, "Proprietary Memory Card" },
+			{ SLOT_IO_RISER_CARD, "I/O Riser Card" },
+			{ SLOT_NUBUS, "NuBus" },
+			{ SLOT_PCI_66MHZ, "PCI 66MHz Capable" },
+			{ SLOT_AGP, "AGP" },
+			{ SLOT_AGP_2X, "AGP 2X" },
+			{ SLOT_AGP_4X, "AGP 4X" },
+			{ SLOT_PCI_X, "PCI-X" },
+			{ SLOT_AGP_8X, "AGP 8X" },
+			{ SLOT_M2_SOCKET_1_DP, "M.2 Socket 1-DP" },
+			{ SLOT_M2_SOCKET_1_SD, "M.2 Socket 1-SD" },
+			{ SLOT_M2_SOCKET_2, "M.2 Socket 2" },
+			{ SLOT_M2_SOCKET_3, "M.2 Socket 3" },
+			{ SLOT_MXM_TYPE_I, "MXM Type I" },
+			{ SLOT_MXM_TYPE_II, "MXM Type II" },
+			{ SLOT_MXM_TYPE_III, "MXM Type III" },
+			{ SLOT_MXM_TYPE_III_HE, "MXM Type III-HE" },
+			{ SLOT_MXM_TYPE_IV, "MXM Type IV" },
+			{ SLOT_MXM3_TYPE_A, "MXM 3.0 Type A" },
+			{ SLOT_MXM3_TYPE_B, "MXM 3.0 Type B" },
+			{ SLOT_PCIE2_U2, "PCI Express 2 SFF-8639 (U.2)" },
+			{ SLOT_PCIE3_U2, "PCI Express 3 SFF-8639 (U.2)" },
+			{ SLOT_PCIE_MINI_52PIN_BOTTOM, "PCI Express Mini 52-pin with bottom-side keep-outs" },
+			{ SLOT_PCIE_MINI_52PIN, "PCI Express Mini 52-pin without bottom-side keep-outs" },
+			{ SLOT_PCIE_MINI_76PIN, "PCI Express Mini 76-pin" },
+			{ SLOT_PCIE4_U2, "PCI Express 4 SFF-8639 (U.2)" },
+			{ SLOT_PCIE5_U2, "PCI Express 5 SFF-8639 (U.2)" },
+			{ SLOT_OCP_NIC3_SFF, "OCP NIC 3.0 SFF" },
+			{ SLOT_OCP_NIC3_LFF, "OCP NIC 3.0 LFF" },
+			{ SLOT_OCP_NIC3, "OCP NIC Prior to 3.0" },
+
+			{ SLOT_CXL_FLEXBUS1, "CXL Flexbus 1.0" },
+
+			{ SLOT_PC98_C20, "PC-98/C20" },
+			{ SLOT_PC98_C24, "PC-98/C24" },
+			{ SLOT_PC98_E, "PC-98/E" },
+			{ SLOT_PC98_LOCAL_BUS, "PC-98/Local Bus" },
+			{ SLOT_PC98_CARD, "PC-98/Card" },
+			{ SLOT_PCIE, "PCI Express" },
+			{ SLOT_PCIE_X1, "PCI Express x1" },
+			{ SLOT_PCIE_X2, "PCI Express x2" },
+			{ SLOT_PCIE_X4, "PCI Express x4" },
+			{ SLOT_PCIE_X8, "PCI Express x8" },
+			{ SLOT_PCIE_X16, "PCI Express x16" },
+			{ SLOT_PCIE2, "PCI Express 2" },
+			{ SLOT_PCIE2_X1, "PCI Express 2 x1" },
+			{ SLOT_PCIE2_X2, "PCI Express 2 x2" },
+			{ SLOT_PCIE2_X4, "PCI Express 2 x4" },
+			{ SLOT_PCIE2_X8, "PCI Express 2 x8" },
+			{ SLOT_PCIE2_X16, "PCI Express 2 x16" },
+			{ SLOT_PCIE3, "PCI Express 3" },
+			{ SLOT_PCIE3_X1, "PCI Express 3 x1" },
+			{ SLOT_PCIE3_X2, "PCI Express 3 x2" },
+			{ SLOT_PCIE3_X4, "PCI Express 3 x4" },
+			{ SLOT_PCIE3_X8, "PCI Express 3 x8" },
+			{ SLOT_PCIE3_X16, "PCI Express 3 x16" },
+			{ SLOT_PCIE4, "PCI Express 4" },
+			{ SLOT_PCIE4_X1, "PCI Express 4 x1" },
+			{ SLOT_PCIE4_X2, "PCI Express 4 x2" },
+			{ SLOT_PCIE4_X4, "PCI Express 4 x4" },
+			{ SLOT_PCIE4_X8, "PCI Express 4 x8" },
+			{ SLOT_PCIE4_X16, "PCI Express 4 x16" },
+			{ SLOT_PCIE5, "PCI Express 5" },
+			{ SLOT_PCIE5_X1, "PCI Express 5 x1" },
+			{ SLOT_PCIE5_X2, "PCI Express 5 x2" },
+			{ SLOT_PCIE5_X4, "PCI Express 5 x4" },
+			{ SLOT_PCIE5_X8, "PCI Express 5 x8" },
+			{ SLOT_PCIE5_X16, "PCI Express 5 x16" },
+			{ SLOT_PCIE6, "PCI Express 6+" },
+			{ SLOT_EDSFF_E1, "EDSFF E1" },
+			{ SLOT_EDSFF_E3, "EDSFF E3" }
+		};
+
+		const char* szSlotType = FindEnumName<arrSlotTypes>(pSS->nSlotType);
+
+		constexpr const char* arrDataBusWidth[] =
+		{
+			"Other",
+			"Unknown",
+			"8-bit",
+			"16-bit",
+			"32-bit",
+			"64-bit",
+			"128-bit",
+			"1x or x1",
+			"2x or x2",
+			"4x or x4",
+			"8x or x8",
+			"12x or x12",
+			"16x or x16",
+			"32x or x32"
+		};
+
+		constexpr const char* arrCurrentUsage[] =
+		{
+			"Other",
+			"Unknown",
+			"Available",
+			"In Use",
+			"Unavailable"
+		};
+
+		constexpr const char* arrSlotLength[] =
+		{
+			"Other",
+			"Unknown",
+			"Short",
+			"Long",
+			"2.5\" drive form factor",
+			"3.5\" drive form factor"
+		};
+
+		emitter.Field("Slot Designation", strings.Get(pSS->nSlotDesignation));
+		emitter.Enum("Slot Type", pSS->nSlotType, szSlotType);
+		emitter.Enum("Slot Databus Width", pSS->nSlotDataBusWidth, arrDataBusWidth[pSS->nSlotDataBusWidth - 1U]);
+		emitter.Enum("Current Usage", pSS->nCurrentUsage, arrCurrentUsage[pSS->nCurrentUsage - 1U]);
+		emitter.Enum("Slot Length", pSS->nSlotLength, arrSlotLength[pSS->nSlotLength - 1U]);
+
+		// @todo: slot id
+
+		constexpr const char* arrCharacteristics[] =
+		{
+			"Unknown",
+			"5V is provided",
+			"3.3V is provided",
+			"Opening is shared",
+			"PC Card-16 is supported",
+			"PC Card supports CardBus",
+			"PC Card supports Zoom Video",
+			"PC Card supports Modem Ring Resume"
+		};
+
+		emitter.BeginList("Slot Characteristics");
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrCharacteristics); ++i)
+		{
+			if (pSS->uSlotCharacteristics & (1U << i))
+				emitter.Item(arrCharacteristics[i]);
+		}
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, uSlotCharacteristicsExtended))
+			break;
+
+		constexpr const char* arrCharacteristicsExtended[] =
+		{
+			"PCI supports PME signal",
+			"Slot supports hot-plug devices",
+			"PCI supports SMBus signal",
+			"PCIe supports bifurcation",
+			"Slot supports async/surprise removal",
+			"Flexbus slot, CXL 1.0 capable",
+			"Flexbus slot, CXL 2.0 capable",
+			"Flexbus slot, CXL 3.0 capable"
+		};
+		for (std::uint16_t i = 0U; i < Q_ARRAYSIZE(arrCharacteristicsExtended); ++i)
+		{
+			if (pSS->uSlotCharacteristicsExtended & (1U << i))
+				emitter.Item(arrCharacteristicsExtended[i]);
+		}
+		emitter.EndList();
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, nSegmentGroupNumber))
+			break;
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, nDataBusWidth))
+		{
+			emitter.Field("Peer Base Data", "S:", COutput::Hex(pSS->nSegmentGroupNumber, 4), " / B:", COutput::Hex(pSS->nBusNumber, 2), " / F:", pSS->uFunctionNumber, " / D:", pSS->uDeviceNumber);
+			break;
+		}
+
+		emitter.Field("Peer Base Data", "S:", COutput::Hex(pSS->nSegmentGroupNumber, 4), " / B:", COutput::Hex(pSS->nBusNumber, 2), " / F:", pSS->uFunctionNumber, " / D:", pSS->uDeviceNumber, " / W:", pSS->nDataBusWidth);
+		emitter.BeginCountedList("Peer Groups", pSS->nPeerGroupingCount);
+		for (std::uint8_t i = 0U; i < pSS->nPeerGroupingCount; ++i)
+		{
+			const SMBIOS::SystemSlotsPeerGroup_t* pPeerGroup = &pSS->arrPeerGroups[i];
+			emitter.NumberedItem(i + 1U, "S:", COutput::Hex(pPeerGroup->uSegmentGroupNumber, 4), " / B:", COutput::Hex(pPeerGroup->uBusNumber, 2), " / F:", pPeerGroup->uFunctionNumber, " / D:", pPeerGroup->uDeviceNumber, " / W:", pPeerGroup->nDataBusWidth);
+		}
+		emitter.EndList();
+
+		const std::uint32_t nTotalPeerGroupsSize = sizeof(SMBIOS::SystemSlotsPeerGroup_t) * pSS->nPeerGroupingCount;
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, arrPeerGroups) + nTotalPeerGroupsSize)
+			break;
+		
+		const std::uint8_t* pStructureEnd = reinterpret_cast<const std::uint8_t*>(pSS->arrPeerGroups) + nTotalPeerGroupsSize;
+		
+		const std::uint8_t uSlotInformation = pStructureEnd[0];
+		if (uSlotInformation != 0U)
+			emitter.Field("Slot Information", uSlotInformation);
+
+		const std::uint8_t nSlotPhysicalWidth = pStructureEnd[1];
+		emitter.Field("Slot Physical Width", nSlotPhysicalWidth);
+
+		const std::uint16_t nSlotPitch = *reinterpret_cast<const std::uint16_t*>(pStructureEnd + 2);
+		if (nSlotPitch != 0U)
+			emitter.Quantity("Slot Pitch", COutput::Fixed(static_cast<float>(nSlotPitch) / 100, 1), "mm");
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, arrPeerGroups) + nTotalPeerGroupsSize + 3U)
+			break;
+
+		constexpr const char* arrSlotHeight[] =
+		{
+			"Not applicable",
+			"Other",
+			"Unknown",
+			"Full",
+			"Low-profile"
+		};
+		const SMBIOS::SlotHeight_t nSlotHeight = pStructureEnd[4];
+		emitter.Enum("Slot Height", nSlotHeight, arrSlotHeight[nSlotHeight]);
+		break;
+	}
+	case SMBIOS::TYPE_ONBOARD_DEVICES_INFORMATION:
+	{
+		const auto pOBDI = reinterpret_cast<const SMBIOS::OnBoardDevicesInformation_t*>(pStructure->arrData);
+
+		const std::uint8_t nCount = (pStructure->nLength - 4U) >> 1U;
+		emitter.BeginUnlabeledList("Devices");
+		for (std::uint8_t i = 0U; i < nCount; ++i)
+		{
+			const SMBIOS::OnBoardDevice_t* pOnBoardDevice = &pOBDI->arrDevices[i];
+			emitter.BeginRecord(i + 1U);
+			emitter.Enum("Type", pOnBoardDevice->nType, arrOnBoardDeviceType[pOnBoardDevice->nType - 1U]);
+			emitter.Boolean("Enabled", pOnBoardDevice->bEnabled);
+			emitter.Field("Description", strings.Get(pOnBoardDevice->nDescription));
+			emitter.EndRecord();
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_OEM_STRINGS:
+	{
+		const auto pOS = reinterpret_cast<const SMBIOS::OemStrings_t*>(pStructure->arrData);
+
+		emitter.BeginUnlabeledList("Strings");
+		for (std::uint8_t i = 1U; i <= pOS->nCount; ++i)
+			emitter.NumberedItem(i, strings.Get(i));
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_CONFIGURATION_OPTIONS:
+	{
+		const auto pSCO = reinterpret_cast<const SMBIOS::SystemConfigurationOptions_t*>(pStructure->arrData);
+
+		emitter.BeginUnlabeledList("Options");
+		for (std::uint8_t i = 1U; i <= pSCO->nCount; ++i)
+			emitter.NumberedItem(i, strings.Get(i));
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_FIRMWARE_LANGUAGE_INFORMATION:
+	{
+		const auto pFLI = reinterpret_cast<const SMBIOS::FirmwareLanguageInformation_t*>(pStructure->arrData);
+
+		// @test: is there a way to get rid of this version check, so that we dont depend on it at all?
+		if (uVersion >= 0x020100)
+			emitter.Field("Lanugage Format", pFLI->bUseAbbreviatedFormat ? "Abbreviated" : "Long");
+
+		emitter.BeginCountedList("Installable Languages", pFLI->nInstallableLanguagesCount);
+		for (std::uint8_t i = 1U; i <= pFLI->nInstallableLanguagesCount; ++i)
+			emitter.NumberedItem(i, strings.Get(i));
+		emitter.EndList();
+
+		emitter.Field("Current Language", strings.Get(pFLI->nCurrentLanguage));
+		break;
+	}
+	case SMBIOS::TYPE_GROUP_ASSOCIATIONS:
+	{
+		const auto pGA = reinterpret_cast<const SMBIOS::GroupAssociations_t*>(pStructure->arrData);
+
+		const std::uint8_t nCount = (pStructure->nLength - 5U) / 3U;
+		emitter.Field("Name", strings.Get(pGA->nGroupName));
+		emitter.BeginCountedList("Items", nCount);
+		for (std::uint8_t i = 0U; i < nCount; ++i)
+		{
+			const SMBIOS::GroupAssociationsItem_t* pItem = &pGA->arrItems[i];
+			emitter.BeginRecord(i + 1U);
+			emitter.Enum("Item Type", pItem->nType, arrStructureType[pItem->nType]);
+			emitter.Handle("Item Handle", pItem->uHandle, DescribeHandle(pHandleIndex, pItem->uHandle).szValue);
+			emitter.EndRecord();
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_EVENT_LOG:
+	{
+		const auto pSEL = reinterpret_cast<const SMBIOS::SystemEventLog_t*>(pStructure->arrData);
+
+		constexpr const char* arrAccessMethod[] =
+		{
+			"Indexed I/O, one 8-bit index port, one 8-bit data port",
+			"Indexed I/O, two 8-bit index ports, one 8-bit data port",
+			"Indexed I/O, one 16-bit index port, one 8-bit data port",
+			"Memory-mapped physical 32-bit address",
+			"General-purpose non-volatile data functions"
+		};
+
+		emitter.Field("Area Length", pSEL->nAreaLength);
+		emitter.HexField("Header Start Offset", pSEL->uHeaderStartOffset, 4);
+		emitter.HexField("Data Start Offset", pSEL->uDataStartOffset, 4);
+		emitter.Enum("Access Method", pSEL->nAccessMethod, pSEL->nAccessMethod >= 0x80 ? "OEM Specific" : arrAccessMethod[pSEL->nAccessMethod]);
+		emitter.Field("Status", pSEL->bAreaValid ? "Valid" : "Invalid", ", ", pSEL->bAreaFull ? "Full" : "Not Full");
+
+		if (pSEL->uChangeToken == 0U)
+			emitter.Field("Change Token", "None");
+		else
+			emitter.HexField("Change Token", pSEL->uChangeToken, 8);
+
+		switch (pSEL->nAccessMethod)
+		{
+		case SMBIOS::EVENT_LOG_ACCESS_METHOD_IO_ONE_8BIT_INDEX_ONE_8BIT_DATA:
+		case SMBIOS::EVENT_LOG_ACCESS_METHOD_IO_TWO_8BIT_INDEX_ONE_8BIT_DATA:
+		case SMBIOS::EVENT_LOG_ACCESS_METHOD_IO_ONE_16BIT_INDEX_ONE_8BIT_DATA:
+			emitter.Field("Access Address", "Index - 0x", COutput::Hex(pSEL->uIndexAddress, 4), ", Data - 0x", COutput::Hex(pSEL->uDataAddress, 4));
+			break;
+		case SMBIOS::EVENT_LOG_ACCESS_METHOD_MEMORY_MAPPED_PHYSICAL_32BIT_ADDRESS:
+			emitter.HexField("Access Address", pSEL->uAccessMethodAddress, 8);
+			break;
+		case SMBIOS::EVENT_LOG_ACCESS_METHOD_GENERAL_PURPOSE_NON_VOLATILE:
+			emitter.Field("Access Address", "GPNV Handle - 0x", COutput::Hex(pSEL->uHandleGPNV, 4));
+			break;
+		default:
+			emitter.Field("Access Address", "Unknown");
+			break;
+		}
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::SystemEventLog_t, nHeaderFormat))
+			break;
+
+		emitter.Enum("Header Format", pSEL->nHeaderFormat, pSEL->nHeaderFormat >= 0x80 ? "OEM Specific" : pSEL->nHeaderFormat == 1U ? "Type 1" : "No Header");
+		
+		if (pSEL->nTypeDescriptorCount != 0U)
+		{
+			emitter.BeginCountedList("Type Descriptors", pSEL->nTypeDescriptorCount);
+			for (std::uint8_t i = 0U; i < pSEL->nTypeDescriptorCount; ++i)
+			{
+				const SMBIOS::EventLogTypeDescriptor_t* pTypeDescriptor = GetEventLogTypeDescriptor(pSEL, i);
+				emitter.BeginRecord(i + 1U);
+				emitter.Enum("Type", pTypeDescriptor->nLogType, GetEventLogTypeName(pTypeDescriptor->nLogType));
+				emitter.Enum("Format Type", pTypeDescriptor->nVariableDataFormatType, GetEventLogFormatTypeName(pTypeDescriptor->nVariableDataFormatType));
+				emitter.EndRecord();
+			}
+			emitter.EndList();
+		}
+
+		// log records are stored in the log area outside of the table, and are decoded by 'DumpEventLog' when the area is given
+
+		break;
+	}
+	case SMBIOS::TYPE_PHYSICAL_MEMORY_ARRAY:
+	{
+		const auto pPMA = reinterpret_cast<const SMBIOS::PhysicalMemoryArray_t*>(pStructure->arrData);
+		
+		const char* szLocation = GetMemoryArrayLocationName(pPMA->nLocation);
+
+		using namespace SMBIOS;
+		constexpr const char* arrUse[] =
+		{
+			"Other",
+			"Unknown",
+			"System Memory",
+			"Video Memory",
+			"Flash Memory",
+			"Non-volatile RAM",
+			"Cache Memory"
+		};
+
+		constexpr const char* arrErrorCorrectionType[] =
+		{
+			"Other",
+			"Unknown",
+			"None",
+			"Parity",
+			"Single-bit ECC",
+			"Multi-bit ECC",
+			"CRC"
+		};
+
+		std::uint64_t ullMaxCapacity = pPMA->uMaxCapacity;
+		if (ullMaxCapacity == 0x80000000)
+			ullMaxCapacity = pPMA->ullMaxCapacityExtended;
+
+		emitter.Enum("Location", pPMA->nLocation, szLocation);
+		emitter.Enum("Use", pPMA->nUse, arrUse[pPMA->nUse - 1U]);
+		emitter.Enum("Memory Error Correction Type", pPMA->nMemoryErrorCorrection, arrErrorCorrectionType[pPMA->nMemoryErrorCorrection - 1U]);
+		emitter.Quantity("Max Capacity", ullMaxCapacity >= 0x100'000 ? (ullMaxCapacity / 0x100'000) : (ullMaxCapacity >= 0x400 ? (ullMaxCapacity / 0x400) : ullMaxCapacity), arrSizeUnit[ullMaxCapacity >= 0x10'0000 ? 2 : (ullMaxCapacity >= 0x400 ? 1 : 0)]);
+
+		if (pPMA->uMemoryErrorInformationHandle == 0xFFFE || pPMA->uMemoryErrorInformationHandle == Q_SMBIOS_HANDLE_INVALID)
+			emitter.Field("Memory Error Information Handle", pPMA->uMemoryErrorInformationHandle == 0xFFFE ? "Not Provided" : "No Error");
+		else
+			emitter.Handle("Memory Error Information Handle", pPMA->uMemoryErrorInformationHandle, DescribeHandle(pHandleIndex, pPMA->uMemoryErrorInformationHandle).szValue);
+
+		emitter.Field("Memory Devices Count", pPMA->nMemoryDevicesCount);
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_DEVICE:
+	{
+		const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData);
+		emitter.Handle("Physical Memory Array Handle", pMD->uPhysicalMemoryArrayHandle, DescribeHandle(pHandleIndex, pMD->uPhysicalMemoryArrayHandle).szValue);
+
+		if (pMD->uMemoryErrorInformationHandle == 0xFFFE || pMD->uMemoryErrorInformationHandle == Q_SMBIOS_HANDLE_INVALID)
+			emitter.Field("Memory Error Information Handle", pMD->uMemoryErrorInformationHandle == 0xFFFE ? "Not Provided" : "No Error");
+		else
+			emitter.Handle("Memory Error Information Handle", pMD->uMemoryErrorInformationHandle, DescribeHandle(pHandleIndex, pMD->uMemoryErrorInformationHandle).szValue);
+
+		if (pMD->nTotalWidth == 0xFFFF)
+			emitter.Field("Total Width", "Unknown");
+		else
+			emitter.Field("Total Width", pMD->nTotalWidth);
+
+		if (pMD->nDataWidth == 0xFFFF)
+			emitter.Field("Data Width", "Unknown");
+		else
+			emitter.Field("Data Width", pMD->nDataWidth);
+
+		std::uint32_t nSize = pMD->nSize;
+		std::uint32_t nSizeGranularity = pMD->nSizeGranulatiry;
+		if (nSize == 0x7FFF)
+		{
+			nSize = pMD->nSizeExtended;
+			nSizeGranularity = pMD->nSizeExtendedGranulatiry;
+		}
+
+		if (nSize == 0U)
+			emitter.Field("Size", "None");
+		else if (nSize == 0xFFFF)
+			emitter.Field("Size", "Unknown");
+		else
+			emitter.Quantity("Size", nSize, arrSizeUnit[nSizeGranularity ^ 1U]);
+
+		constexpr const char* arrFormFactor[] =
+		{
+			"Other",
+			"Unknown",
+			"SIMM",
+			"SIP",
+			"Chip",
+			"DIP",
+			"ZIP",
+			"Proprietary Card",
+			"DIMM",
+			"TSOP",
+			"Row Of Chips",
+			"RIMM",
+			"SODIMM",
+			"SRIMM",
+			"FB-DIMM",
+			"Die"
+		};
+		emitter.Enum("Form Factor", pMD->nFormFactor, arrFormFactor[pMD->nFormFactor - 1U]);
+
+		if (pMD->uDeviceSet == 0U)
+			emitter.Field("Device Set", "None");
+		else if (pMD->uDeviceSet == 0xFF)
+			emitter.Field("Device Set", "Unknown");
+		else
+			emitter.Field("Device Set", pMD->uDeviceSet);
+
+		constexpr const char* arrType[] =
+		{
+			"Other",
+			"Unknown",
+			"DRAM",
+			"EDRAM",
+			"VRAM",
+			"SRAM",
+			"RAM",
+			"ROM",
+			"Flash",
+			"EEPROM",
+			"FEPROM",
+			"EPROM",
+			"CDRAM",
+			"3DRAM",
+			"SDRAM",
+			"SGRAM",
+			"RDRAM",
+			"DDR",
+			"DDR2",
+			"DDR2 FB-DIMM",
+			"Reserved",
+			"Reserved",
+			"Reserved",
+			"DDR3",
+			"FBD2",
+			"DDR4",
+			"LPDDR",
+			"LPDDR2",
+			"LPDDR3",
+			"LPDDR4",
+			"Logical non-volatile device",
+			"HBM",
+			"HBM2",
+			"DDR5",
+			"LPDDR5",
+			"HBM3"
+		};
+		emitter.Field("Device Locator", strings.Get(pMD->nDeviceLocator));
+		emitter.Field("Bank Locator", strings.Get(pMD->nBankLocator));
+		emitter.Enum("Memory Type", pMD->nMemoryType, arrType[pMD->nMemoryType - 1U]);
+
+		static const char* arrTypeDetail[] =
+		{
+			"Other",
+			"Unknown",
+			"Fast-paged",
+			"Static Column",
+			"Pseudo-static",
+			"Rambus",
+			"Synchronous",
+			"CMOS",
+			"EDO",
+			"Window DRAM",
+			"Cache DRAM",
+			"Non-Volatile",
+			"Registered (Buffered)",
+			"Unregistered (Unbuffered)",
+			"LRDIMM"
+		};
+		emitter.BeginList("Type Detail");
+		for (std::uint16_t i = 1U; i < Q_ARRAYSIZE(arrTypeDetail); ++i)
+		{
+			if (pMD->uTypeDetail & (1U << i))
+				emitter.Item(arrTypeDetail[i]);
+		}
+		emitter.EndList();
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uSpeed))
+			break;
+
+		std::uint32_t uSpeed = pMD->uSpeed;
+		if (uSpeed == 0xFFFF)
+			uSpeed = pMD->uSpeedExtended;
+
+		if (uSpeed == 0U)
+			emitter.Field("Speed", "Unknown");
+		else
+			emitter.Quantity("Speed", uSpeed, "MT/s");
+
+		emitter.Field("Manufacturer", strings.Get(pMD->nManufacturer));
+		emitter.Field("Serial Number", strings.Get(pMD->nSerialNumber));
+		emitter.Field("Asset Tag", strings.Get(pMD->nAssetTag));
+		emitter.Field("Part Number", strings.Get(pMD->nPartNumber));
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uAttributes))
+			break;
+
+		emitter.Field("Rank", pMD->uRank);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uAttributes) + 1U)
+			break;
+
+		std::uint32_t uConfiguredSpeed = pMD->uConfiguredSpeed;
+		if (uConfiguredSpeed == 0xFFFF)
+			uConfiguredSpeed = pMD->uConfiguredSpeedExtended;
+
+		if (uConfiguredSpeed == 0U)
+			emitter.Field("Configured Speed", "Unknown");
+		else
+			emitter.Quantity("Configured Speed", uConfiguredSpeed, "MT/s");
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uMinVoltage))
+			break;
+
+		emitter.Quantity("Min Voltage", pMD->uMinVoltage, "mV");
+		emitter.Quantity("Max Voltage", pMD->uMaxVoltage, "mV");
+		emitter.Quantity("Configured Voltage", pMD->uConfiguredVoltage, "mV");
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, nMemoryTechnology))
+			break;
+
+		constexpr const char* arrTechnology[] =
+		{
+			"Other",
+			"Unknown",
+			"DRAM",
+			"NVDIMM-N",
+			"NVDIMM-F",
+			"NVDIMM-P",
+			"Intel Optane DC persistent memory",
+			"MRDIMM"
+		};
+		emitter.Enum("Memory Technology", pMD->nMemoryTechnology, arrTechnology[pMD->nMemoryTechnology - 1U]);
+
+		constexpr const char* arrOperatingModeCapability[] =
+		{
+			"Other",
+			"Unknown",
+			"Volatile memory",
+			"Byte-accessible persistent memory",
+			"Block-accessible persistent memory"
+		};
+
+		emitter.BeginList("Operating Mode Capability");
+		for (std::uint16_t i = 1U; i < Q_ARRAYSIZE(arrOperatingModeCapability); ++i)
+		{
+			if (pMD->uOperatingModeCapability & (1U << i))
+				emitter.Item(arrOperatingModeCapability[i]);
+		}
+		emitter.EndList();
+
+		emitter.Field("Firmware Version", strings.Get(pMD->nFirmwareVersion));
+
+		if (pMD->uModuleManufacturerID == 0U)
+			emitter.Field("Module Manufacturer ID", "Unknown");
+		else
+			emitter.HexField("Module Manufacturer ID", pMD->uModuleManufacturerID, 4);
+
+		if (pMD->uModuleProductID == 0U)
+			emitter.Field("Module Product ID", "Unknown");
+		else
+			emitter.HexField("Module Product ID", pMD->uModuleProductID, 4);
+
+		if (pMD->uMemorySubsystemControllerManufacturerID == 0U)
+			emitter.Field("Subsystem Controller Manufacturer ID", "Unknown");
+		else
+			emitter.HexField("Subsystem Controller Manufacturer ID", pMD->uMemorySubsystemControllerManufacturerID, 4);
+
+		if (pMD->uMemorySubsystemControllerProductID == 0U)
+			emitter.Field("Subsystem Controller Product ID", "Unknown");
+		else
+			emitter.HexField("Subsystem Controller Product ID", pMD->uMemorySubsystemControllerProductID, 4);
+
+		if (pMD->ullNonVolatileSize == 0ULL)
+			emitter.Field("Non Volatile Size", "None");
+		else if (pMD->ullNonVolatileSize == ~0ULL)
+			emitter.Field("Non Volatile Size", "Unknown");
+		else
+			emitter.Field("Non Volatile Size", pMD->ullNonVolatileSize);
+
+		if (pMD->ullVolatileSize == 0ULL)
+			emitter.Field("Volatile Size", "None");
+		else if (pMD->ullVolatileSize == ~0ULL)
+			emitter.Field("Volatile Size", "Unknown");
+		else
+			emitter.Field("Volatile Size", pMD->ullVolatileSize);
+
+		if (pMD->ullCacheSize == 0ULL)
+			emitter.Field("Cache Size", "None");
+		else if (pMD->ullCacheSize == ~0ULL)
+			emitter.Field("Cache Size", "Unknown");
+		else
+			emitter.Field("Cache Size", pMD->ullCacheSize);
+
+		if (pMD->ullLogicalSize == 0ULL)
+			emitter.Field("Logical Size", "None");
+		else if (pMD->ullLogicalSize == ~0ULL)
+			emitter.Field("Logical Size", "Unknown");
+		else
+			emitter.Field("Logical Size", pMD->ullLogicalSize);
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uPMIC0ManufacturerID))
+			break;
+
+		if (pMD->uPMIC0ManufacturerID == 0U)
+			emitter.Field("PMIC0 Manufacturer ID", "Unknown");
+		else
+			emitter.HexField("PMIC0 Manufacturer ID", pMD->uPMIC0ManufacturerID, 4);
+
+		if (pMD->uPMIC0RevisionNumber == 0xFF00)
+			emitter.Field("PMIC0 Revision Number", "Unknown");
+		else
+			emitter.HexField("PMIC0 Revision Number", pMD->uPMIC0RevisionNumber, 4);
+		
+		if (pMD->uRCDManufacturerID == 0U)
+			emitter.Field("RCD Manufacturer ID", "Unknown");
+		else
+			emitter.HexField("RCD Manufacturer ID", pMD->uRCDManufacturerID, 4);
+
+		if (pMD->uRCDRevisionNumber == 0xFF00)
+			emitter.Field("RCD Revision Number", "Unknown");
+		else
+			emitter.HexField("RCD Revision Number", pMD->uRCDRevisionNumber, 4);
+
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_ARRAY_MAPPED_ADDRESS:
+	{
+		const auto pMAMA = reinterpret_cast<const SMBIOS::MemoryArrayMappedAddress_t*>(pStructure->arrData);
+
+		std::uint64_t ullStartingAddress = pMAMA->uStartingAddress;
+		if (ullStartingAddress == ~0U)
+			ullStartingAddress = pMAMA->ullStartingAddressExtended;
+
+		std::uint64_t ullEndingAddress = pMAMA->uEndingAddress;
+		if (ullEndingAddress == ~0U)
+			ullEndingAddress = pMAMA->ullEndingAddressExtended;
+
+		emitter.HexField("Starting Address", ullStartingAddress, 16);
+		emitter.HexField("Ending Address", ullEndingAddress, 16);
+		emitter.Handle("Array Handle", pMAMA->uArrayHandle, DescribeHandle(pHandleIndex, pMAMA->uArrayHandle).szValue);
+		emitter.Field("Partition Width", pMAMA->nPartitionWidth);
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_DEVICE_MAPPED_ADDRESS:
+	{
+		const auto pMDMA = reinterpret_cast<const SMBIOS::MemoryDeviceMappedAddress_t*>(pStructure->arrData);
+
+		std::uint64_t ullStartingAddress = pMDMA->uStartingAddress;
+		if (ullStartingAddress == ~0U)
+			ullStartingAddress = pMDMA->ullStartingAddressExtended;
+
+		std::uint64_t ullEndingAddress = pMDMA->uEndingAddress;
+		if (ullEndingAddress == ~0U)
+			ullEndingAddress = pMDMA->ullEndingAddressExtended;
+
+		emitter.HexField("Starting Address", ullStartingAddress, 16);
+		emitter.HexField("Ending Address", ullEndingAddress, 16);
+		emitter.Handle("Device Handle", pMDMA->uDeviceHandle, DescribeHandle(pHandleIndex, pMDMA->uDeviceHandle).szValue);
+		emitter.Handle("Array Mapped Address Handle", pMDMA->uArrayMappedAddressHandle, DescribeHandle(pHandleIndex, pMDMA->uArrayMappedAddressHandle).szValue);
+
+		if (pMDMA->uPartitionRowPosition == 0xFF)
+			emitter.Field("Partition Row Position", "Unknown");
+		else
+			emitter.Field("Partition Row Position", pMDMA->uPartitionRowPosition);
+
+		if (pMDMA->uInterleavePosition == 0xFF)
+			emitter.Field("Interleave Position", "Unknown");
+		else
+			emitter.Field("Interleave Position", pMDMA->uInterleavePosition);
+
+		if (pMDMA->uInterleaveDataDepth == 0xFF)
+			emitter.Field("Interleave Data Depth", "Unknown");
+		else
+			emitter.Field("Interleave Data Depth", pMDMA->uInterleaveDataDepth);
+
+		break;
+	}
+	case SMBIOS::TYPE_PORTABLE_BATTERY:
+	{
+		const auto pPB = reinterpret_cast<const SMBIOS::PortableBattery_t*>(pStructure->arrData);
+		emitter.Field("Location", strings.Get(pPB->nLocation));
+		emitter.Field("Manufacturer", strings.Get(pPB->nManufacturer));
+
+		if (pPB->nManufactureDate == Q_SMBIOS_STRING_INVALID)
+			emitter.Field("Manufacture Date", pPB->nManufactureDaySBDS, ".", pPB->nManufactureMonthSBDS, ".", pPB->nManufactureYearSBDS);
+		else
+			emitter.Field("Manufacture Date", strings.Get(pPB->nManufactureDate));
+
+		if (pPB->nSerialNumber == Q_SMBIOS_STRING_INVALID)
+			emitter.HexField("Serial Number", pPB->uSerialNumberSBDS, 4);
+		else
+			emitter.Field("Serial Number", strings.Get(pPB->nSerialNumber));
+
+		constexpr const char* arrChemistry[] =
+		{
+			"Other",
+			"Unknown",
+			"Lead Acid",
+			"Nickel Cadmium",
+			"Nickel Metal Hydride",
+			"Lithium Ion",
+			"Zinc Air",
+			"Lithium Polymer"
+		};
+
+		emitter.Field("\nDevice Name", strings.Get(pPB->nDeviceName));
+		emitter.Enum("Device Chemistry", pPB->nDeviceChemistry, (pPB->nDeviceChemistry == SMBIOS::PORTABLE_BATTERY_CHEMISTRY_UNKNOWN && pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::PortableBattery_t, nDeviceChemistrySBDS)) ?
+				strings.Get(pPB->nDeviceChemistrySBDS).szValue :
+				arrChemistry[pPB->nDeviceChemistry - 1U]);
+
+		if (pPB->uDesignCapacity == 0U)
+			emitter.Field("Design Capacity", "Unknown");
+		else
+		{
+			if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::PortableBattery_t, uDesignCapacityMultiplier))
+				emitter.Quantity("Design Capacity", pPB->uDesignCapacity, "mWh");
+			else
+				emitter.Quantity("Design Capacity", static_cast<std::uint32_t>(pPB->uDesignCapacity) * pPB->uDesignCapacityMultiplier, "mWh");
+		}
+
+		if (pPB->uDesignVoltage == 0U)
+			emitter.Field("Design Voltage", "Unknown");
+		else
+			emitter.Quantity("Design Voltage", pPB->uDesignVoltage, "mV");
+
+		if (const COutput::String_t versionNumber = strings.Get(pPB->nVersionNumberSBDS); versionNumber.szValue != nullptr)
+			emitter.Field("Version Number", versionNumber);
+		else
+			emitter.Field("Version Number", "Unknown");
+
+		if (pPB->uMaxDataError == 0xFF)
+			emitter.Field("Max Error", "Unknown");
+		else
+			emitter.Quantity("Max Error", pPB->uMaxDataError, "%");
+
+		if (pStructure->nLength <= SMB_FIELD_OFFSET(SMBIOS::PortableBattery_t, uOemSpecific))
+			break;
+
+		emitter.HexField("OEM Specific", pPB->uOemSpecific, 8);
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_POWER_CONTROLS:
+	{
+		const auto pSPC = reinterpret_cast<const SMBIOS::SystemPowerControls_t*>(pStructure->arrData);
+
+		// values are BCD encoded, so they're formatted as hexadecimal, with asterisk in place of the invalid ones
+		COutput nextPowerOn(32U);
+		if (pSPC->uNextPowerOnMonth >= 0x01 && pSPC->uNextPowerOnMonth <= 0x12)
+			nextPowerOn.Print(COutput::Hex(pSPC->uNextPowerOnMonth, 2));
+		else
+			nextPowerOn.Print("*");
+		if (pSPC->uNextPowerOnDay >= 0x01 && pSPC->uNextPowerOnDay <= 0x31)
+			nextPowerOn.Print("-", COutput::Hex(pSPC->uNextPowerOnDay, 2));
+		else
+			nextPowerOn.Print("-*");
+		if (pSPC->uNextPowerOnHour <= 0x23)
+			nextPowerOn.Print(" ", COutput::Hex(pSPC->uNextPowerOnHour, 2));
+		else
+			nextPowerOn.Print(" *");
+		if (pSPC->uNextPowerOnMinute <= 0x59)
+			nextPowerOn.Print(":", COutput::Hex(pSPC->uNextPowerOnMinute, 2));
+		else
+			nextPowerOn.Print(":*");
+		if (pSPC->uNextPowerOnSecond <= 0x59)
+			nextPowerOn.Print(":", COutput::Hex(pSPC->uNextPowerOnSecond, 2));
+		else
+			nextPowerOn.Print(":*");
+		nextPowerOn.Append('\0');
+
+		emitter.Field("Next Scheduled Power-On", nextPowerOn.GetData());
+		break;
+
+	}
+	case SMBIOS::TYPE_BOOT_INTEGRITY_SERVICES_ENTRY_POINT:
+	{
+		break;
+	}
+	case SMBIOS::TYPE_SYSTEM_BOOT_INFORMATION:
+	{
+		const auto pSBI = reinterpret_cast<const SMBIOS::SystemBootInformation_t*>(pStructure->arrData);
+
+		constexpr const char* arrBootStatus[] =
+		{
+			"No errors detected",
+			"No bootable media",
+			"Normal operating system failed to load",
+			"Firmware-detected hardware failure",
+			"Operating system-detected hardware failure",
+			"User-requested boot",
+			"System security violation",
+			"Previously requested image",
+			"System watchdog timer expired"
+		};
+		emitter.Enum("Boot Status", pSBI->nBootStatus, pSBI->nBootStatus >= 192 ?
+
+				"Product specific" :
+				pSBI->nBootStatus >= 128 ?
+					"Vendor/OEM specific" :
+					pSBI->nBootStatus >= Q_ARRAYSIZE(arrBootStatus) ?
+						"Reserved" :
+						arrBootStatus[pSBI->nBootStatus]);
+		break;
+	}
+	case SMBIOS::TYPE_MEMORY_CHANNEL:
+	{
+		const auto pMC = reinterpret_cast<const SMBIOS::MemoryChannel_t*>(pStructure->arrData);
+		
+		constexpr const char* arrType[] =
+		{
+			"Other",
+			"Unknown",
+			"Rambus",
+			"SyncLink",
+		};
+		emitter.Enum("Type", pMC->nType, arrType[pMC->nType - 1U]);
+		emitter.Field("Max Load", pMC->uMaxLoad);
+
+		emitter.BeginUnlabeledList("Devices");
+		for (std::uint8_t i = 1U; i <= pMC->nDeviceCount; ++i)
+		{
+			const SMBIOS::MemoryChannelDevice_t* pDevice = &pMC->arrDevices[i];
+			emitter.BeginRecord(i);
+			emitter.Field("Load", pDevice->uLoad);
+			emitter.Handle("Handle", pDevice->uHandle, DescribeHandle(pHandleIndex, pDevice->uHandle).szValue);
+			emitter.EndRecord();
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_IPMI_DEVICE_INFORMATION:
+	{
+		const auto pIPMI = reinterpret_cast<const SMBIOS::IPMIDeviceInformation_t*>(pStructure->arrData);
+
+		static const char* arrInterfaceType[] =
+		{
+			"Unknown",
+			"KCS (Keyboard Control Style)",
+			"SMIC (Server Management Interface Chip)",
+			"BT (Block Transfer)",
+			"SSIF (SMBus System Interface)"
+		};
+		emitter.Enum("Interface Type", pIPMI->nInterfaceType, arrInterfaceType[pIPMI->nInterfaceType]);
+		emitter.Field("Specification Revision", pIPMI->uSpecificationRevision >> 4U, ".", pIPMI->uSpecificationRevision & 0xF);
+		emitter.HexField("I2C Target Address", pIPMI->uTargetAddressI2C, 2);
+
+		if (pIPMI->uStorageDeviceAddressNV == 0xFF)
+			emitter.Field("NV Storage Device Address", "None");
+		else
+			emitter.HexField("NV Storage Device Address", pIPMI->uStorageDeviceAddressNV, 2);
+
+		if (pIPMI->nInterfaceType == SMBIOS::BMC_INTERFACE_SSIF)
+			emitter.Field("Base Address", "0x", COutput::Hex(pIPMI->ullBaseAddress, 16), " (", pIPMI->bBaseAddressIoSpace ? "I/O Space" : "Memory-Mapped", ")");
+		else
+		{
+			constexpr const char* arrRegisterSpacing[] =
+			{
+				"Successive Byte Boundaries",
+				"32-bit Boundaries",
+				"16-byte Boundaries"
+			};
+
+			emitter.Field("Base Address", "0x", COutput::Hex((pIPMI->ullBaseAddress << 1ULL) | pIPMI->uBaseAddressLSB, 16), " (", pIPMI->bBaseAddressIoSpace ? "I/O Space" : "Memory-Mapped", ")");
+			emitter.Enum("Register Spacing", pIPMI->nBaseAddressRegisterSpacing, arrRegisterSpacing[pIPMI->nBaseAddressRegisterSpacing]);
+		}
+
+		if (pIPMI->bInterruptInfoSpecified)
+		{
+			emitter.Field("Interrupt Trigger Mode", pIPMI->nInterruptTriggerMode ? "Level" : "Edge");
+			emitter.Field("Interrupt Polarity", pIPMI->nInterruptPolarity ? "Active High" : "Active Low");
+		}
+
+		if (pIPMI->uInterruptNumber == 0U)
+			emitter.Field("Interrupt Number", "None");
+		else
+			emitter.Field("Interrupt Number", pIPMI->uInterruptNumber);
+
+		break;
+	}
+	case SMBIOS::TYPE_ADDITIONAL_INFORMATION:
+	{
+		const auto pAI = reinterpret_cast<const SMBIOS::AdditionalInformation_t*>(pStructure->arrData);
+
+		const SMBIOS::AdditionalInformationEntry_t* pEntry = &pAI->arrEntries[0];
+		emitter.BeginUnlabeledList("Entries");
+		for (std::uint8_t i = 0U; i < pAI->nEntriesCount; ++i)
+		{
+			emitter.BeginRecord(0U);
+			emitter.Handle("Referenced Handle", pEntry->uReferencedHandle, DescribeHandle(pHandleIndex, pEntry->uReferencedHandle).szValue);
+			emitter.HexField("Referenced Offset", pEntry->uReferencedOffset, 2);
+			emitter.Field("String", strings.Get(pEntry->nString));
+			
+			const std::uint8_t* arrValue = reinterpret_cast<const std::uint8_t*>(pEntry) + sizeof(SMBIOS::AdditionalInformationEntry_t);
+			const std::uint8_t nValueSize = pEntry->nLength - sizeof(SMBIOS::AdditionalInformationEntry_t);
+			emitter.Bytes("Value", arrValue, nValueSize);
+			emitter.EndRecord();
+
+			pEntry = reinterpret_cast<const SMBIOS::AdditionalInformationEntry_t*>(reinterpret_cast<const std::uint8_t*>(pEntry) + pEntry->nLength);
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_ONBOARD_DEVICES_EXTENDED_INFORMATION:
+	{
+		const auto pODEI = reinterpret_cast<const SMBIOS::OnBoardDevicesExtendedInformation_t*>(pStructure->arrData);
+		emitter.Field("Reference Designation", strings.Get(pODEI->nReferenceDesignation));
+		emitter.Enum("Type", pODEI->nType, arrOnBoardDeviceType[pODEI->nType - 1U]);
+		emitter.Boolean("Enabled", pODEI->bEnabled);
+		emitter.Field("Type Instance", pODEI->uTypeInstance);
+
+		if (pODEI->uSegmentGroupNumber != 0xFF && pODEI->uBusNumber != 0xFF && (pODEI->uFunctionNumber | (pODEI->uDeviceNumber << 3U)) != 0xFF)
+			emitter.Field("Group", "S:", COutput::Hex(pODEI->uSegmentGroupNumber, 4), " / B:", COutput::Hex(pODEI->uBusNumber, 2), " / F:", pODEI->uFunctionNumber, " / D:", pODEI->uDeviceNumber);
+		
+		break;
+	}
+	case SMBIOS::TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE:
+	{
+		const auto pMCHI = reinterpret_cast<const SMBIOS::ManagementControllerHostInterface_t*>(pStructure->arrData);
+		
+		using namespace SMBIOS;
+		static constexpr EnumName_t arrType[] =
+		{
+			// MCTP
+			{ HOST_INTERFACE_KCS, "Keyboard Controller Style (KCS)" },
+			{ HOST_INTERFACE_UART_8250, "8250 UART Register Compatible" },
+			{ HOST_INTERFACE_UART_16450, "16450 UART Register Compatible" },
+			{ HOST_INTERFACE_UART_16550, "16550/16550A UART Register Compatible" },
+			{ HOST_INTERFACE_UART_16650, "16650/16650A UART Register Compatible" },
+			{ HOST_INTERFACE_UART_16750, "16750/16750A UART Register Compatible" },
+			{ HOST_INTERFACE_UART_16850, "16850/16850A UART Register Compatible" },
+			{ HOST_INTERFACE_I2C_SMBUS, "I2C / SMBUS" },
+			{ HOST_INTERFACE_I3C, "I3C" },
+			{ HOST_INTERFACE_PCIE_VDM, "PCIe VDM" },
+			{ HOST_INTERFACE_MMBI, "MMBI" },
+			{ HOST_INTERFACE_PPC, "PPC" },
+			{ HOST_INTERFACE_UCIE, "UCIe" },
+			{ HOST_INTERFACE_USB, "USB" },
+			// NETWORK
+			{ HOST_INTERFACE_NETWORK, "Network Host Interface" }
+		};
+
+		emitter.Enum("Type", pMCHI->nType, FindEnumName<arrType>(pMCHI->nType));
+		emitter.Bytes("Type Specific Data", pMCHI->arrTypeSpecificData, pMCHI->nTypeSpecificDataLength);
+
+		static constexpr EnumName_t arrProtocolType[] =
+		{
+			{ HOST_INTERFACE_PROTOCOL_IPMI, "IPMI" },
+			{ HOST_INTERFACE_PROTOCOL_MCTP, "MCTP" },
+			{ HOST_INTERFACE_PROTOCOL_REDFISH, "Redfish-over-IP" },
+			{ HOST_INTERFACE_PROTOCOL_OEM_DEFINED, "OEM Defined" }
+		};
+
+		const std::uint8_t nProtocolRecordCount = *(pMCHI->arrTypeSpecificData + pMCHI->nTypeSpecificDataLength);
+		const ProtocolRecordData_t* pProtocolRecord = reinterpret_cast<const ProtocolRecordData_t*>(pMCHI->arrTypeSpecificData + pMCHI->nTypeSpecificDataLength + 1U);
+		emitter.BeginCountedList("Protocol Records", nProtocolRecordCount);
+		for (std::uint8_t i = 0U; i < nProtocolRecordCount; ++i)
+		{
+			// @todo: we dont parse protocol specific data
+			emitter.BeginRecord(i + 1U);
+			emitter.Enum("Type", pProtocolRecord->nType, FindEnumName<arrProtocolType>(pProtocolRecord->nType));
+			emitter.Bytes("Type Specific Data", pProtocolRecord->arrTypeSpecificData, pProtocolRecord->nTypeSpecificDataLength);
+			emitter.EndRecord();
+
+			pProtocolRecord = reinterpret_cast<const ProtocolRecordData_t*>(pProtocolRecord->arrTypeSpecificData + pProtocolRecord->nTypeSpecificDataLength);
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_TPM_DEVICE:
+	{
+		const auto pTPM = reinterpret_cast<const SMBIOS::TPMDevice_t*>(pStructure->arrData);
+		
+		emitter.HexField("Vendor ID", *reinterpret_cast<const std::uint32_t*>(pTPM->arrVendorID), 8);
+		emitter.Field("Version", pTPM->uVersionMajor, ".", pTPM->uVersionMinor);
+		emitter.Field("Firmware Version", "0x", COutput::Hex(pTPM->uFirmwareVersionHigh, 8), COutput::Hex(pTPM->uFirmwareVersionLow, 8));
+		emitter.Field("Description", strings.Get(pTPM->nDescription));
+
+		if (!pTPM->bCharacteristicsNotSupported)
+		{
+			emitter.BeginList("Characteristics");
+			if (pTPM->bFamilyConfigurableViaFirmwareUpdate)
+				emitter.Item("Family configurable via firmware update");
+			if (pTPM->bFamilyConfigurableViaPlatformSoftwareSupport)
+				emitter.Item("Family configurable via platform software support");
+			if (pTPM->bFamilyConfigurableViaOemProprietaryMechanism)
+				emitter.Item("Family configurable via OEM proprietary mechanism");
+			emitter.EndList();
+		}
+
+		emitter.HexField("OEM Specific", pTPM->uOemDefined, 8);
+		break;
+	}
+	case SMBIOS::TYPE_PROCESSOR_ADDITIONAL_INFORMATION:
+	{
+		const auto pPAI = reinterpret_cast<const SMBIOS::ProcessorAdditionalInformation_t*>(pStructure->arrData);
+		emitter.Handle("Referenced Handle", pPAI->uReferencedHandle, DescribeHandle(pHandleIndex, pPAI->uReferencedHandle).szValue);
+		emitter.BeginList("Specific Block");
+
+		constexpr const char* arrArchitectureType[] =
+		{
+			"IA32 (x86)",
+			"x64 (x86-64, Intel64, AMD64, EM64T)",
+			"Intel Itanium",
+			"32-bit ARM (Aarch32)",
+			"64-bit ARM (Aarch64)",
+			"32-bit RISC-V (RV32)",
+			"64-bit RISC-V (RV64)",
+			"128-bit RISC-V (RV128)",
+			"32-bit LoongArch (LoongArch32)",
+			"64-bit LoongArch (LoongArch64)",
+		};
+
+		std::uint8_t nProcessorSpecificBlockLength = pStructure->nLength - (sizeof(SMBIOS::StructureHeader_t) + sizeof(SMBIOS::ProcessorAdditionalInformation_t));
+		const SMBIOS::ProcessorSpecificBlock_t* pBlock = pPAI->arrBlocks;
+
+		// @test: it's unclear if it's possible there to be multiple blocks, tho i've added support for that if so
+		std::uint8_t nIndex = 0U;
+		while (nProcessorSpecificBlockLength != 0U)
+		{
+			emitter.BeginRecord(++nIndex);
+			emitter.Enum("Architecture Type", pBlock->nArchitectureType, arrArchitectureType[pBlock->nArchitectureType - 1U]);
+
+			// @todo: we dont parse arch specific data
+			const std::uint8_t* arrSpecificData = reinterpret_cast<const std::uint8_t*>(pBlock + 1);
+			emitter.Bytes("Specific Data", arrSpecificData, pBlock->nDataLength);
+			emitter.EndRecord();
+
+			nProcessorSpecificBlockLength -= sizeof(SMBIOS::ProcessorSpecificBlock_t) + pBlock->nDataLength;
+			pBlock = reinterpret_cast<const SMBIOS::ProcessorSpecificBlock_t*>(arrSpecificData + pBlock->nDataLength);
+		}
+		emitter.EndList();
+
+		break;
+	}
+	case SMBIOS::TYPE_FIRMWARE_INVENTORY_INFORMATION:
+	{
+		const auto pFII = reinterpret_cast<const SMBIOS::FirmwareInventoryInformation_t*>(pStructure->arrData);
+
+		emitter.Field("Firmware Component Name", strings.Get(pFII->nFirmwareComponentName));
+		emitter.Field("Firmware Version", strings.Get(pFII->nFirmwareVersion));
+		emitter.Field("Firmware ID", strings.Get(pFII->nFirmwareID));
+		emitter.Field("Release Date", strings.Get(pFII->nReleaseDate));
+		emitter.Field("Manufacturer", strings.Get(pFII->nManufacturer));
+		emitter.Field("Lowest Supported Firmware Version", strings.Get(pFII->nLowestSupportedFirmwareVersion));
+
+		if (pFII->ullImageSize == ~0ULL)
+			emitter.Field("Image Size", "Unknown");
+		else
+			emitter.Quantity("Image Size", pFII->ullImageSize >= 0x100'000 ? (pFII->ullImageSize / 0x100'000) : (pFII->ullImageSize >= 0x400 ? (pFII->ullImageSize / 0x400) : pFII->ullImageSize), arrSizeUnit[pFII->ullImageSize >= 0x10'0000 ? 2 : (pFII->ullImageSize >= 0x400 ? 1 : 0)]);
+
+		if (pFII->uCharacteristics == 0ULL)
+			emitter.Field("Characteristics", "None");
+		else
+		{
+			emitter.BeginList("Characteristics");
+			if (pFII->bUpdateable)
+				emitter.Item("Updateable");
+			if (pFII->bWriteProtect)
+				emitter.Item("Write-Protect");
+			emitter.EndList();
+		}
+
+		constexpr const char* arrState[] =
+		{
+			"Other",
+			"Unknown",
+			"Disabled",
+			"Enabled",
+			"Absent",
+			"Standby Offline",
+			"Standby Spare",
+			"Unavailable Offline",
+		};
+
+		emitter.Enum("State", pFII->nState, arrState[pFII->nState - 1U]);
+		emitter.BeginCountedList("Associated Components", pFII->nAssociatedComponentCount);
+		for (std::uint8_t i = 0U; i < pFII->nAssociatedComponentCount; ++i)
+		{
+			emitter.BeginRecord(i + 1U);
+			emitter.Handle("Handle", pFII->arrAssociatedComponentHandles[i], DescribeHandle(pHandleIndex, pFII->arrAssociatedComponentHandles[i]).szValue);
+			emitter.EndRecord();
+		}
+		emitter.EndList();
+
+		break;
+	}
+	default:
+		break;
+	}
+
+	emitter.EndStructure();
+}
+
+bool ParseEntryPoint(CEmitter& emitter, const std::uint8_t* pEntryPoint, const std::size_t nEntryPointSize, std::uint32_t* puVersion, std::uint32_t* pnTableLength, std::uint64_t* pullTableAddress)
+{
+	// check for 2.X version magic
+	if (nEntryPointSize >= 0x1F && std::memcmp(pEntryPoint, "_SM_", 4U) == 0)
+	{
+		const std::uint8_t nEntryPointLength = pEntryPoint[0x5];
+		if (nEntryPointLength != 0x1F) // @test: also 0x1E
+		{
+			emitter.Error("unexpected entry point length: 0x", COutput::Hex(nEntryPointLength, 2));
+			return false;
+		}
+
+		const std::uint8_t* pIntermediateAnchorString = &pEntryPoint[0x10];
+		if (std::memcmp(pIntermediateAnchorString, "_DMI_", 5U) != 0)
+		{
+			emitter.Error("unknown entry point intermediate anchor string");
+			return false;
+		}
+
+		// store the SMBIOS version
+		*puVersion = (pEntryPoint[0x6] << 16U) | (pEntryPoint[0x7] << 8U);
+		// store the structure table length
+		*pnTableLength = pEntryPoint[0x16] | (pEntryPoint[0x17] << 8U);
+		// store the structure table address
+		*pullTableAddress = pEntryPoint[0x18] | (pEntryPoint[0x19] << 8U) | (pEntryPoint[0x1A] << 16U) | (static_cast<std::uint32_t>(pEntryPoint[0x1B]) << 24U);
+	}
+	// otherwise check for 3.X version magic
+	else if (nEntryPointSize >= 0x18 && std::memcmp(pEntryPoint, "_SM3_", 5U) == 0)
+	{
+		const std::uint8_t nEntryPointLength = pEntryPoint[0x6];
+		if (nEntryPointLength != 0x18)
+		{
+			emitter.Error("unexpected entry point length: 0x", COutput::Hex(nEntryPointLength, 2));
+			return false;
+		}
+
+		const std::uint8_t uEntryPointRevision = pEntryPoint[0xA];
+		if (uEntryPointRevision != 0x1)
+		{
+			emitter.Error("unexpected entry point revision: 0x", COutput::Hex(uEntryPointRevision, 2));
+			return false;
+		}
+
+		// store the SMBIOS version
+		*puVersion = (pEntryPoint[0x7] << 16U) | (pEntryPoint[0x8] << 8U) | pEntryPoint[0x9];
+		// store the structure table maximum length
+		*pnTableLength = pEntryPoint[0xC] | (pEntryPoint[0xD] << 8U) | (pEntryPoint[0xE] << 16U) | (static_cast<std::uint32_t>(pEntryPoint[0xF]) << 24U);
+		// store the structure table address
+		std::uint64_t ullTableAddress = 0ULL;
+		for (std::size_t i = 0U; i < sizeof(std::uint64_t); ++i)
+			ullTableAddress |= static_cast<std::uint64_t>(pEntryPoint[0x10 + i]) << (i * 8U);
+		*pullTableAddress = ullTableAddress;
+	}
+	else
+	{
+		emitter.Error("unknown entry point");
+		return false;
+	}
+
+	return true;
+}
+
+// smallest count of structures, that is worth decoding by the separate worker
+constexpr std::size_t nMinRangeStructureCount = 16U;
+
+// decode the structures in range [nBegin, nEnd) of the table boundaries
+static void DumpStructureRange(CEmitter& emitter, const DecodeOptions_t& options, const std::uint8_t* pTableData, const std::vector<std::uint32_t>& vecBoundaries, const std::size_t nBegin, const std::size_t nEnd, const std::uint32_t uVersion, const CHandleIndex* pHandleIndex)
+{
+	for (std::size_t i = nBegin; i < nEnd; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+
+		// skip the unwanted structure without reading its strings
+		if (!options.IsTypeWanted(pStructure->nType))
+			continue;
+
+		// strings are located only when the structure decoder accesses them
+		CStringSet strings(pStructure, pTableData + vecBoundaries[i + 1U]);
+
+		// process the current structure
+		HandleStructure(emitter, pStructure, strings, uVersion, pHandleIndex);
+	}
+}
+
+/*
+ * decode the structures of the table in parallel, each range of structures to its own output, which are then merged in order
+ * @remarks: structures are decoded independently of each other, and the handle index is only read, so the output is identical to the serial decoding
+ */
+static void DumpStructureRangesParallel(CEmitter& emitter, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, const std::size_t nStructureCount, const std::uint32_t uVersion, const CHandleIndex* pHandleIndex)
+{
+	// split into more ranges than workers, so they're balanced by stealing when the structures differ in the decoding cost
+	constexpr std::size_t nRangesPerJob = 4U;
+	const std::size_t nRangeCount = std::min(options.nTableJobCount * nRangesPerJob, nStructureCount / nMinRangeStructureCount);
+
+	if (state.pTablePool == nullptr)
+		state.pTablePool.reset(new CWorkStealingPool(options.nTableJobCount));
+
+	while (state.vecRangeOutputs.size() < nRangeCount)
+		state.vecRangeOutputs.emplace_back(new COutput());
+
+	const std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	state.pTablePool->Run(nRangeCount, [&](const std::size_t nRangeIndex, [[maybe_unused]] const std::size_t nWorkerIndex)
+	{
+		COutput& outputRange = *state.vecRangeOutputs[nRangeIndex];
+		outputRange.Clear();
+
+		CEmitter emitterRange(outputRange, emitter);
+		DumpStructureRange(emitterRange, options, pTableData, vecBoundaries, nStructureCount * nRangeIndex / nRangeCount, nStructureCount * (nRangeIndex + 1U) / nRangeCount, uVersion, pHandleIndex);
+	});
+
+	for (std::size_t i = 0U; i < nRangeCount; ++i)
+		emitter.AppendRange(*state.vecRangeOutputs[i]);
+}
+
+void DumpStructureTable(CEmitter& emitter, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, const std::size_t nTableSize, const std::uint32_t uVersion)
+{
+	// output the current version
+	emitter.BeginTable(uVersion);
+
+	// find all structures at once, so the string-sets are searched for the terminators only once
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	const bool bReachedEnd = FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	// index all structures first, so the handles referencing following structures are resolved as well
+	CHandleIndex* pHandleIndex = (options.bResolveHandles ? &state.handleIndex : nullptr);
+	if (pHandleIndex != nullptr)
+	{
+		pHandleIndex->Reset(pTableData);
+
+		for (std::size_t i = 0U; i < nStructureCount; ++i)
+			pHandleIndex->Insert(reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]));
+	}
+
+	// small tables aren't worth waking up the workers, and the visitor is called on the calling thread only
+	if (options.nTableJobCount > 1U && emitter.GetFormat() != OUTPUT_FORMAT_VISITOR && nStructureCount >= 2U * nMinRangeStructureCount)
+		DumpStructureRangesParallel(emitter, state, options, pTableData, nStructureCount, uVersion, pHandleIndex);
+	else
+		DumpStructureRange(emitter, options, pTableData, vecBoundaries, 0U, nStructureCount, uVersion, pHandleIndex);
+
+	if (!bReachedEnd)
+		emitter.Error("structure at offset 0x", COutput::Hex(vecBoundaries.back(), 1), " exceeds the table boundary");
+
+	emitter.EndTable();
+}
+
+bool LocateDumpTable(CEmitter& emitter, const std::uint8_t* pDumpData, const std::size_t nDumpSize, const std::uint8_t** ppTableData, std::size_t* pnTableSize, std::uint32_t* puVersion)
+{
+	std::uint32_t nLength = 0U;
+	std::uint64_t ullAddress = 0ULL;
+	if (!ParseEntryPoint(emitter, pDumpData, nDumpSize, puVersion, &nLength, &ullAddress))
+		return false;
+
+	if (ullAddress >= nDumpSize)
+	{
+		emitter.Error("structure table address 0x", COutput::Hex(ullAddress, 1), " is out of the dump bounds");
+		return false;
+	}
+
+	// 3.X entry point stores maximum length, so the actual table may be smaller
+	std::size_t nTableSize = nDumpSize - static_cast<std::size_t>(ullAddress);
+	if (nLength < nTableSize)
+		nTableSize = nLength;
+
+	*ppTableData = pDumpData + ullAddress;
+	*pnTableSize = nTableSize;
+	return true;
+}
+
+void VisitStructureTable(IStructureVisitor& visitor, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, const std::size_t nTableSize, const std::uint32_t uVersion)
+{
+	CEmitter emitter(state.outputScratch, visitor);
+	DumpStructureTable(emitter, state, options, pTableData, nTableSize, uVersion);
+}
+
+void DumpStructure(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pStructureEnd, const std::uint32_t uVersion, const CHandleIndex* pHandleIndex)
+{
+	CStringSet strings(pStructure, pStructureEnd);
+	HandleStructure(emitter, pStructure, strings, uVersion, pHandleIndex);
+}
+
+void VisitStructure(IStructureVisitor& visitor, DecodeState_t& state, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pStructureEnd, const std::uint32_t uVersion)
+{
+	CEmitter emitter(state.outputScratch, visitor);
+	DumpStructure(emitter, pStructure, pStructureEnd, uVersion, nullptr);
+}
+
+bool VisitDump(IStructureVisitor& visitor, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pDumpData, const std::size_t nDumpSize)
+{
+	CEmitter emitter(state.outputScratch, visitor);
+
+	const std::uint8_t* pTableData = nullptr;
+	std::size_t nTableSize = 0U;
+	std::uint32_t uVersion = 0U;
+	if (!LocateDumpTable(emitter, pDumpData, nDumpSize, &pTableData, &nTableSize, &uVersion))
+		return false;
+
+	DumpStructureTable(emitter, state, options, pTableData, nTableSize, uVersion);
+	return true;
+}
+
+// read the value of the log record variable data, which isn't aligned
+template <typename T>
+static T ReadUnaligned(const std::uint8_t* pData)
+{
+	T value;
+	std::memcpy(&value, pData, sizeof(T));
+	return value;
+}
+
+// output the variable data of the log record of the given format type
+static void DumpEventLogVariableData(CEmitter& emitter, const std::uint8_t nFormatType, const std::uint8_t* pData, const std::size_t nDataSize)
+{
+	// each format is the sequence of the handle, the 32-bit counters and the types
+	switch (nFormatType)
+	{
+	case 0x00:
+		return;
+	case 0x01:
+		if (nDataSize < 2U)
+			break;
+
+		emitter.Handle("Handle", ReadUnaligned<std::uint16_t>(pData), "");
+		return;
+	case 0x02:
+		if (nDataSize < 4U)
+			break;
+
+		emitter.Field("Counter", ReadUnaligned<std::uint32_t>(pData));
+		return;
+	case 0x03:
+		if (nDataSize < 6U)
+			break;
+
+		emitter.Handle("Handle", ReadUnaligned<std::uint16_t>(pData), "");
+		emitter.Field("Counter", ReadUnaligned<std::uint32_t>(pData + 2U));
+		return;
+	case 0x04:
+		if (nDataSize < 8U)
+			break;
+
+		emitter.HexField("POST Results Bitmap 1", ReadUnaligned<std::uint32_t>(pData), 8);
+		emitter.HexField("POST Results Bitmap 2", ReadUnaligned<std::uint32_t>(pData + 4U), 8);
+		return;
+	case 0x05:
+		if (nDataSize < 4U)
+			break;
+
+		emitter.HexField("System Management Type", ReadUnaligned<std::uint32_t>(pData), 8);
+		return;
+	case 0x06:
+		if (nDataSize < 8U)
+			break;
+
+		emitter.HexField("System Management Type", ReadUnaligned<std::uint32_t>(pData), 8);
+		emitter.Field("Counter", ReadUnaligned<std::uint32_t>(pData + 4U));
+		return;
+	default:
+		break;
+	}
+
+	// data of the unknown, OEM specific, or too short format is output as is
+	if (nDataSize > 0U)
+		emitter.Bytes("Variable Data", pData, nDataSize);
+}
+
+bool DumpEventLog(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pAreaData, const std::size_t nAreaSize, const std::uint32_t uVersion)
+{
+	const auto pSEL = reinterpret_cast<const SMBIOS::SystemEventLog_t*>(pStructure->arrData);
+	const std::size_t nAreaEnd = std::min<std::size_t>(pSEL->nAreaLength, nAreaSize);
+
+	// format of the variable data of each log type, as described by the structure, the undescribed types have none
+	std::array<std::uint8_t, 256U> arrFormatTypes;
+	arrFormatTypes.fill(0xFF);
+	if (pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::SystemEventLog_t, nTypeDescriptorLength))
+	{
+		const std::size_t nDescriptorLength = std::max<std::size_t>(pSEL->nTypeDescriptorLength, sizeof(SMBIOS::EventLogTypeDescriptor_t));
+		const std::size_t nDescriptorCount = std::min<std::size_t>(pSEL->nTypeDescriptorCount, (pStructure->nLength - SMB_FIELD_OFFSET(SMBIOS::SystemEventLog_t, arrTypeDescriptorsList)) / nDescriptorLength);
+		for (std::size_t i = 0U; i < nDescriptorCount; ++i)
+		{
+			const SMBIOS::EventLogTypeDescriptor_t* pTypeDescriptor = GetEventLogTypeDescriptor(pSEL, static_cast<std::uint8_t>(i));
+			arrFormatTypes[pTypeDescriptor->nLogType] = pTypeDescriptor->nVariableDataFormatType;
+		}
+	}
+
+	emitter.BeginTable(uVersion);
+	emitter.BeginStructure(pStructure, "System Event Log Records");
+	emitter.Field("Area Length", nAreaEnd);
+
+	const bool bHasHeaderFormat = (pStructure->nLength > SMB_FIELD_OFFSET(SMBIOS::SystemEventLog_t, nHeaderFormat));
+	if (bHasHeaderFormat && pSEL->nHeaderFormat == 1U && pSEL->uHeaderStartOffset + sizeof(EventLogHeaderType1_t) <= nAreaEnd)
+	{
+		const auto pHeader = reinterpret_cast<const EventLogHeaderType1_t*>(pAreaData + pSEL->uHeaderStartOffset);
+		emitter.BeginGroup("Log Header");
+		emitter.Quantity("Multiple Event Time Window", pHeader->nMultipleEventTimeWindow, "min");
+		emitter.Field("Multiple Event Count Increment", pHeader->nMultipleEventCountIncrement);
+		emitter.HexField("Pre-boot Event Log Reset CMOS Address", pHeader->uPreBootEventLogResetCMOSAddress, 2);
+		emitter.Field("Pre-boot Event Log Reset CMOS Bit Index", pHeader->nPreBootEventLogResetCMOSBitIndex);
+		emitter.HexField("CMOS Checksum Starting Offset", pHeader->uCMOSChecksumStartingOffset, 2);
+		emitter.Field("CMOS Checksum Byte Count", pHeader->nCMOSChecksumByteCount);
+		emitter.HexField("CMOS Checksum Offset", pHeader->uCMOSChecksumOffset, 2);
+		emitter.Field("Header Revision", pHeader->nHeaderRevision);
+		emitter.EndGroup();
+	}
+
+	// records are decoded in place one by one, so the log is never copied however large it is
+	std::size_t nOffset = pSEL->uDataStartOffset;
+	std::size_t nRecordCount = 0U;
+	bool bReachedEnd = true;
+	emitter.BeginList("Records");
+	while (nOffset < nAreaEnd && pAreaData[nOffset] != SMBIOS::EVENT_LOG_END)
+	{
+		const auto pRecord = reinterpret_cast<const EventLogRecordHeader_t*>(pAreaData + nOffset);
+		const std::size_t nRecordLength = (nAreaEnd - nOffset >= 2U ? pRecord->nLength & 0x7FU : 0U);
+		if (nRecordLength < sizeof(EventLogRecordHeader_t) || nRecordLength > nAreaEnd - nOffset)
+		{
+			bReachedEnd = false;
+			break;
+		}
+
+		emitter.BeginRecord(++nRecordCount);
+		emitter.Enum("Type", pRecord->nLogType, GetEventLogTypeName(pRecord->nLogType));
+		emitter.Field("Date", pRecord->uYear >= 0x80 ? "19" : "20", COutput::Hex(pRecord->uYear, 2), "-", COutput::Hex(pRecord->uMonth, 2), "-", COutput::Hex(pRecord->uDay, 2), " ", COutput::Hex(pRecord->uHour, 2), ":", COutput::Hex(pRecord->uMinute, 2), ":", COutput::Hex(pRecord->uSecond, 2));
+		emitter.Field("Status", (pRecord->nLength & 0x80U) != 0U ? "Read" : "Unread");
+		DumpEventLogVariableData(emitter, arrFormatTypes[pRecord->nLogType], pAreaData + nOffset + sizeof(EventLogRecordHeader_t), nRecordLength - sizeof(EventLogRecordHeader_t));
+		emitter.EndRecord();
+
+		nOffset += nRecordLength;
+	}
+	emitter.EndList();
+	emitter.EndStructure();
+
+	if (pSEL->uDataStartOffset > nAreaEnd)
+	{
+		emitter.Error("log data start offset 0x", COutput::Hex(pSEL->uDataStartOffset, 4), " is out of the area bounds");
+		bReachedEnd = false;
+	}
+	else if (!bReachedEnd)
+		emitter.Error("log record at offset 0x", COutput::Hex(nOffset, 4), " has invalid length or exceeds the area boundary");
+
+	emitter.EndTable();
+	return bReachedEnd;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "emitter.h"
+#include "index.h"
+#include "output.h"
+#include "pool.h"
+#include "visitor.h"
+
+/*
+ * decoding library of the structure tables, that has no global state and doesn't write anywhere by itself
+ * tables are decoded either to the text or JSON output through the emitter, or reported to the visitor with the typed values
+ */
+
+// settings of the tables decoding
+struct DecodeOptions_t
+{
+	// describe the structures referenced by the handles
+	bool bResolveHandles = false;
+	EOutputFormat nFormat = OUTPUT_FORMAT_TEXT;
+	// count of workers decoding the structures of the single table in parallel, the table is decoded serially when it's one
+	std::size_t nTableJobCount = 1U;
+	// output only the structures of types from the bitmap
+	bool bFilterTypes = false;
+	std::uint64_t arrTypeFilter[4] = { };
+
+	void AddTypeFilter(const std::uint8_t nType)
+	{
+		arrTypeFilter[nType >> 6U] |= 1ULL << (nType & 63U);
+		bFilterTypes = true;
+	}
+
+	[[nodiscard]] bool IsTypeWanted(const std::uint8_t nType) const
+	{
+		return !bFilterTypes || ((arrTypeFilter[nType >> 6U] >> (nType & 63U)) & 1U) != 0U;
+	}
+};
+
+// state of the tables decoding, that is reused between the tables, each thread must use its own
+struct DecodeState_t
+{
+	CHandleIndex handleIndex;
+	// offsets of the structures of the current table
+	std::vector<std::uint32_t> vecStructureBoundaries;
+	// workers decoding the ranges of structures of the current table, created on the first parallel decoding
+	std::unique_ptr<CWorkStealingPool> pTablePool;
+	// decoded output of each range of structures, that is merged into the table output in order
+	std::vector<std::unique_ptr<COutput>> vecRangeOutputs;
+	// buffer of the values made of several parts, that are reported to the visitor
+	COutput outputScratch { 256U };
+};
+
+/*
+ * parse SMBIOS 2.X or 3.X entry point
+ * @returns: true if entry point is valid, false otherwise
+ */
+bool ParseEntryPoint(CEmitter& emitter, const std::uint8_t* pEntryPoint, std::size_t nEntryPointSize, std::uint32_t* puVersion, std::uint32_t* pnTableLength, std::uint64_t* pullTableAddress);
+
+/*
+ * locate the structure table in the dump of 'dmidecode --dump-bin' format, it consists of the entry point at the beginning, and the structure table at the address stored in it
+ * @returns: true if dump is valid, false otherwise
+ */
+bool LocateDumpTable(CEmitter& emitter, const std::uint8_t* pDumpData, std::size_t nDumpSize, const std::uint8_t** ppTableData, std::size_t* pnTableSize, std::uint32_t* puVersion);
+
+/*
+ * walk through all structures of the given table and output them to the emitter
+ * @remarks: walking stops at the end of table structure or when the next structure doesn't fit into the table
+ */
+void DumpStructureTable(CEmitter& emitter, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, std::size_t nTableSize, std::uint32_t uVersion);
+
+/*
+ * walk through all structures of the given table and report them to the visitor, in order and on the calling thread
+ * @remarks: output format and count of table jobs of the options are ignored
+ */
+void VisitStructureTable(IStructureVisitor& visitor, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pTableData, std::size_t nTableSize, std::uint32_t uVersion);
+
+/*
+ * output the single structure to the emitter, e.g. to keep the decoded structures separately
+ * @param[in] pStructureEnd byte past the double-null terminator of the structure string-set, e.g. as found by 'FindStructureBoundaries'
+ * @param[in] pHandleIndex index of the table structures to describe the referenced ones, null to not describe them
+ */
+void DumpStructure(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pStructureEnd, std::uint32_t uVersion, const CHandleIndex* pHandleIndex);
+
+/*
+ * report the single structure to the visitor, e.g. to get its fields on demand
+ * @param[in] pStructureEnd byte past the double-null terminator of the structure string-set, e.g. as found by 'FindStructureBoundaries'
+ * @remarks: referenced structures aren't described, as the other structures of the table are unknown
+ */
+void VisitStructure(IStructureVisitor& visitor, DecodeState_t& state, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pStructureEnd, std::uint32_t uVersion);
+
+/*
+ * locate the structure table in the dump of 'dmidecode --dump-bin' format and report its structures to the visitor
+ * @returns: true if dump is valid, false otherwise, the reason is reported to the visitor as the error
+ */
+bool VisitDump(IStructureVisitor& visitor, DecodeState_t& state, const DecodeOptions_t& options, const std::uint8_t* pDumpData, std::size_t nDumpSize);
+
+/*
+ * walk through the records of the system event log area and output them to the emitter, as the records structure of the given system event log structure
+ * @param[in] pAreaData log area of the memory-mapped physical 32-bit address access method, e.g. mapped from the physical memory at the access method address, or saved to the file
+ * @remarks: walking stops at the end of log record, at the end of area, or when the record doesn't fit into the area. records are decoded in place, so the area must stay valid while it's walked
+ * @returns: true if log has been walked to its end, false otherwise
+ */
+bool DumpEventLog(CEmitter& emitter, const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pAreaData, std::size_t nAreaSize, std::uint32_t uVersion);
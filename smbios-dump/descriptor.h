@@ -0,0 +1,188 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "lookup.h"
+
+enum EFieldKind : std::uint8_t
+{
+	// index of the structure string
+	FIELD_KIND_STRING = 0,
+	// unsigned integer in decimal
+	FIELD_KIND_INTEGER,
+	// unsigned integer in hexadecimal of the given count of digits
+	FIELD_KIND_HEX,
+	// unsigned integer divided by the divisor, in the given unit
+	FIELD_KIND_QUANTITY,
+	// flag written as 'true' or 'false'
+	FIELD_KIND_BOOLEAN,
+	// index to the dense name table, starting from the base value
+	FIELD_KIND_ENUM,
+	// value looked up in the sparse name table, unlisted values are reserved
+	FIELD_KIND_SPARSE_ENUM,
+	// handle of the referenced structure
+	FIELD_KIND_HANDLE
+};
+
+/*
+ * compile-time description of the single structure field, from which the decoder of the field is instantiated instead of the hand-written code
+ * @remarks: descriptors are built with the kind functions below, and adjusted with the chained modifiers, e.g. 'QuantityField(...).Special(0x8000, "Unknown").Optional()'
+ */
+struct FieldDescriptor_t
+{
+	[[nodiscard]] constexpr FieldDescriptor_t Bits(const std::uint8_t nShift, const std::uint8_t nCount) const
+	{
+		FieldDescriptor_t field = *this;
+		field.nBitShift = nShift;
+		field.nBitCount = nCount;
+		return field;
+	}
+
+	// @param[in] szText text of the special value, when null, field is omitted instead
+	[[nodiscard]] constexpr FieldDescriptor_t Special(const std::uint64_t ullValue, const char* szText) const
+	{
+		FieldDescriptor_t field = *this;
+		field.bHasSpecialValue = true;
+		field.ullSpecialValue = ullValue;
+		field.szSpecialValue = szText;
+		return field;
+	}
+
+	// field is present only when the structure length exceeds its offset, e.g. when it's introduced by the later specification version
+	[[nodiscard]] constexpr FieldDescriptor_t Optional() const
+	{
+		FieldDescriptor_t field = *this;
+		field.nMinimumLength = static_cast<std::uint8_t>(nOffset + 1U);
+		return field;
+	}
+
+	// @todo: zero was formatted with '%.u' that outputs nothing, keep it to match the previous text output
+	[[nodiscard]] constexpr FieldDescriptor_t EmptyZeroText() const
+	{
+		FieldDescriptor_t field = *this;
+		field.bEmptyZeroText = true;
+		return field;
+	}
+
+	const char* szLabel = nullptr;
+	EFieldKind nKind = FIELD_KIND_INTEGER;
+	// offset of the value from the beginning of the structure header
+	std::uint8_t nOffset = 0U;
+	// size of the value in bytes, or of the integer that contains the bit field
+	std::uint8_t nSize = 1U;
+	std::uint8_t nBitShift = 0U;
+	// count of bits of the bit field, zero if the value is the whole integer
+	std::uint8_t nBitCount = 0U;
+	// field is decoded only when the structure is at least of this length
+	std::uint8_t nMinimumLength = 0U;
+	// count of hexadecimal digits, or count of the decimal digits after the point of the quantity
+	std::uint8_t nDigitCount = 0U;
+	// value of the first name of the dense name table
+	std::uint8_t nNameBase = 0U;
+	std::uint16_t nNameCount = 0U;
+	const char* const* arrNames = nullptr;
+	// lookup of the sparse name table
+	const char* (*fnFindName)(std::uint32_t uValue, const char* szDefault) = nullptr;
+	std::uint32_t uDivisor = 1U;
+	const char* szUnit = nullptr;
+	bool bHasSpecialValue = false;
+	bool bEmptyZeroText = false;
+	std::uint64_t ullSpecialValue = 0ULL;
+	const char* szSpecialValue = nullptr;
+};
+
+[[nodiscard]] constexpr FieldDescriptor_t StringField(const char* szLabel, const std::uint8_t nOffset)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_STRING;
+	field.nOffset = nOffset;
+	return field;
+}
+
+[[nodiscard]] constexpr FieldDescriptor_t IntegerField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_INTEGER;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	return field;
+}
+
+[[nodiscard]] constexpr FieldDescriptor_t HexField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize, const std::uint8_t nDigitCount)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_HEX;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	field.nDigitCount = nDigitCount;
+	return field;
+}
+
+/*
+ * @param[in] nDigitCount count of the decimal digits after the point, when zero, value is divided as an integer
+ */
+[[nodiscard]] constexpr FieldDescriptor_t QuantityField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize, const char* szUnit, const std::uint32_t uDivisor = 1U, const std::uint8_t nDigitCount = 0U)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_QUANTITY;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	field.szUnit = szUnit;
+	field.uDivisor = uDivisor;
+	field.nDigitCount = nDigitCount;
+	return field;
+}
+
+[[nodiscard]] constexpr FieldDescriptor_t BooleanField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize, const std::uint8_t nBit)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_BOOLEAN;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	field.nBitShift = nBit;
+	field.nBitCount = 1U;
+	return field;
+}
+
+template <std::size_t N>
+[[nodiscard]] constexpr FieldDescriptor_t EnumField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize, const char* const (&arrNames)[N], const std::uint8_t nNameBase)
+{
+	static_assert(N <= 0xFFFF);
+
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_ENUM;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	field.arrNames = arrNames;
+	field.nNameCount = static_cast<std::uint16_t>(N);
+	field.nNameBase = nNameBase;
+	return field;
+}
+
+template <const auto& arrEnumNames>
+[[nodiscard]] constexpr FieldDescriptor_t SparseEnumField(const char* szLabel, const std::uint8_t nOffset, const std::uint8_t nSize)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_SPARSE_ENUM;
+	field.nOffset = nOffset;
+	field.nSize = nSize;
+	field.fnFindName = &FindEnumName<arrEnumNames>;
+	return field;
+}
+
+[[nodiscard]] constexpr FieldDescriptor_t HandleField(const char* szLabel, const std::uint8_t nOffset)
+{
+	FieldDescriptor_t field;
+	field.szLabel = szLabel;
+	field.nKind = FIELD_KIND_HANDLE;
+	field.nOffset = nOffset;
+	field.nSize = 2U;
+	return field;
+}
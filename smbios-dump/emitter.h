@@ -0,0 +1,998 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <q-tee/smbios/smbios.h>
+
+#include "output.h"
+#include "visitor.h"
+
+enum EOutputFormat : std::uint8_t
+{
+	// human readable 'Key: Value' lines
+	OUTPUT_FORMAT_TEXT = 0,
+	// single JSON document per table
+	OUTPUT_FORMAT_JSON,
+	// single JSON document per structure, each on its own line
+	OUTPUT_FORMAT_NDJSON,
+	// typed values reported to the visitor of the library, it's not selectable from the command line
+	OUTPUT_FORMAT_VISITOR
+};
+
+/*
+ * semantic writer of the decoded tables, that formats the same fields either as text or as typed JSON members
+ * @remarks: text format produces exactly the same text as the plain output, JSON member names are derived from the text labels
+ * in visitor format, the output is used only as the scratch buffer for the values that are made of several parts
+ */
+class CEmitter
+{
+public:
+	/*
+	 * @param[in] szSource name of the decoded dump, included to each JSON document when not null
+	 */
+	CEmitter(COutput& output, const EOutputFormat nFormat, const char* szSource = nullptr) :
+		output(output), nFormat(nFormat), szSource(szSource) { }
+
+	// @param[in] outputScratch buffer to format the values that are made of several parts, e.g. 'Size: 16 MB', before they're reported
+	CEmitter(COutput& outputScratch, IStructureVisitor& visitor) :
+		output(outputScratch), nFormat(OUTPUT_FORMAT_VISITOR), pVisitor(&visitor) { }
+
+	/*
+	 * emitter of the range of structures to the separate output, that continues from the current state of the table emitter
+	 * @remarks: ranges are decoded independently of each other, e.g. in parallel, and then merged back in the table order with 'AppendRange'
+	 */
+	CEmitter(COutput& output, const CEmitter& emitterTable) :
+		output(output), nFormat(emitterTable.nFormat), szSource(emitterTable.szSource), uVersion(emitterTable.uVersion), nDepth(emitterTable.nDepth)
+	{
+		for (std::size_t i = 0U; i <= nMaxDepth; ++i)
+		{
+			arrClosingBracket[i] = emitterTable.arrClosingBracket[i];
+			arrNeedSeparator[i] = emitterTable.arrNeedSeparator[i];
+		}
+
+		// whether the first structure of the range is separated depends on the preceding ranges, so it's decided on merge
+		arrNeedSeparator[nDepth] = false;
+	}
+
+	CEmitter(const CEmitter&) = delete;
+	CEmitter& operator=(const CEmitter&) = delete;
+
+	[[nodiscard]] EOutputFormat GetFormat() const
+	{
+		return nFormat;
+	}
+
+	void BeginTable(const std::uint32_t uTableVersion)
+	{
+		uVersion = uTableVersion;
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->BeginTable(uVersion);
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print("SMBIOS - ", (uVersion & 0xFF0000) >> 16U, ".", (uVersion & 0x00FF00) >> 8U, ".", (uVersion & 0x0000FF), "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_JSON)
+		{
+			Open('{');
+			WriteHeaderMembers();
+			WriteKey("structures");
+			Open('[');
+		}
+	}
+
+	void EndTable()
+	{
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->EndTable();
+			return;
+		}
+
+		if (nFormat != OUTPUT_FORMAT_JSON)
+			return;
+
+		CloseTo(0U);
+		output.Append('\n');
+	}
+
+	void BeginStructure(const SMBIOS::StructureHeader_t* pStructure, const char* szName)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print("\n[", szName, "]\n");
+			nGroupDepth = 0U;
+			bInRecord = false;
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->BeginStructure(pStructure, szName);
+			nStructureDepth = nDepth;
+			return;
+		}
+
+		BeginElement();
+		Open('{');
+		if (nFormat == OUTPUT_FORMAT_NDJSON)
+			WriteHeaderMembers();
+
+		WriteKey("type");
+		output.Append(pStructure->nType);
+		WriteKey("name");
+		WriteString(szName);
+		WriteKey("handle");
+		output.Append(pStructure->uHandle);
+		WriteKey("length");
+		output.Append(pStructure->nLength);
+		WriteKey("fields");
+		Open('{');
+
+		nStructureDepth = nDepth - 2U;
+	}
+
+	// @remarks: lists that are left open, e.g. when the structure is truncated in the middle of the list, are closed as well
+	void EndStructure()
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+			return;
+
+		CloseTo(nStructureDepth);
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+			pVisitor->EndStructure();
+		else if (nFormat == OUTPUT_FORMAT_NDJSON)
+			output.Append('\n');
+	}
+
+	// field, which value is formatted from the given values, single value keeps its type in JSON, otherwise the value is a string
+	template <typename... T>
+	void Field(const char* szLabel, const T&... values)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": ", values..., "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Field(szLabel, MakeValue(values...));
+			return;
+		}
+
+		WriteKey(szLabel);
+		WriteValue(values...);
+	}
+
+	// field with the hexadecimal value, written as number in JSON
+	template <typename T>
+	void HexField(const char* szLabel, const T value, const std::uint8_t nWidth)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": 0x", COutput::Hex(value, nWidth), "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Field(szLabel, MakeTypedValue(COutput::Hex(value, nWidth)));
+			return;
+		}
+
+		WriteKey(szLabel);
+		output.Append(COutput::Hex(value, nWidth).ullValue);
+	}
+
+	/*
+	 * field with the boolean value, written as 'true' or 'false' literal in JSON
+	 * @param[in] szTrueText, szFalseText text of the values in text format, that keep the previous text output
+	 */
+	void Boolean(const char* szLabel, const bool bValue, const char* szTrueText = "true", const char* szFalseText = "false")
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": ", bValue ? szTrueText : szFalseText, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Field(szLabel, MakeTypedValue(bValue));
+			return;
+		}
+
+		WriteKey(szLabel);
+		output.Append(bValue ? "true" : "false");
+	}
+
+	// field with the numeric value in the given unit, written as '{ "value", "unit" }' object in JSON
+	template <typename T>
+	void Quantity(const char* szLabel, const T value, const char* szUnit)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": ", value, szUnit, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			DecodedValue_t decodedValue = MakeTypedValue(value);
+			decodedValue.szUnit = szUnit;
+			pVisitor->Field(szLabel, decodedValue);
+			return;
+		}
+
+		WriteKey(szLabel);
+		Open('{');
+		WriteKey("value");
+		WriteTypedValue(value);
+		WriteKey("unit");
+		WriteString(szUnit);
+		Close();
+	}
+
+	// field with the decoded enumeration, written as '{ "code", "name" }' object in JSON
+	template <typename T>
+	void Enum(const char* szLabel, const T nCode, const char* szName)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": ", szName, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			DecodedValue_t decodedValue = MakeTypedValue(szName);
+			decodedValue.nKind = VALUE_KIND_ENUM;
+			decodedValue.ullInteger = static_cast<std::uint64_t>(nCode);
+			pVisitor->Field(szLabel, decodedValue);
+			return;
+		}
+
+		WriteKey(szLabel);
+		Open('{');
+		WriteKey("code");
+		WriteTypedValue(nCode);
+		WriteKey("name");
+		WriteString(szName);
+		Close();
+	}
+
+	/*
+	 * field referencing the other structure, written as integer in JSON
+	 * @param[in] szDescription text appended to the handle in text format
+	 */
+	void Handle(const char* szLabel, const std::uint16_t uHandle, const char* szDescription)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ": 0x", COutput::Hex(uHandle, 4), szDescription, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Field(szLabel, MakeHandleValue(uHandle));
+			return;
+		}
+
+		WriteKey(szLabel);
+		output.Append(uHandle);
+	}
+
+	// group of the fields, that are following on the separate indented lines
+	void BeginGroup(const char* szLabel)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(szLabel, ":\n");
+			++nGroupDepth;
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->BeginGroup(szLabel);
+			Open('{');
+			return;
+		}
+
+		WriteKey(szLabel);
+		Open('{');
+	}
+
+	void EndGroup()
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			--nGroupDepth;
+			return;
+		}
+
+		Close();
+	}
+
+	// field with the raw bytes, written as space separated hexadecimal bytes in text format and as array of numbers in JSON
+	void Bytes(const char* szLabel, const std::uint8_t* pData, const std::size_t nDataSize)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			WriteIndentation();
+			output.Print(szLabel, ":");
+			for (std::size_t i = 0U; i < nDataSize; ++i)
+				output.Print(" ", COutput::Hex(pData[i], 2));
+			output.Append('\n');
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			DecodedValue_t decodedValue;
+			decodedValue.nKind = VALUE_KIND_BYTES;
+			decodedValue.pBytes = pData;
+			decodedValue.nByteCount = nDataSize;
+			pVisitor->Field(szLabel, decodedValue);
+			return;
+		}
+
+		WriteKey(szLabel);
+		Open('[');
+		for (std::size_t i = 0U; i < nDataSize; ++i)
+		{
+			BeginElement();
+			output.Append(pData[i]);
+		}
+		Close();
+	}
+
+	// list, which items are following on the separate indented lines
+	void BeginList(const char* szLabel)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(szLabel, ":\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+			pVisitor->BeginList(szLabel);
+		else
+			WriteKey(szLabel);
+		Open('[');
+	}
+
+	// list, which count of items is written on the label line and items are following on the separate numbered lines
+	template <typename T>
+	void BeginCountedList(const char* szLabel, const T nCount)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(szLabel, ": ", nCount, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+			pVisitor->BeginList(szLabel);
+		else
+			WriteKey(szLabel);
+		Open('[');
+	}
+
+	// list, which items are following on the label line
+	void BeginInlineList(const char* szLabel)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(szLabel, ": ");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+			pVisitor->BeginList(szLabel);
+		else
+			WriteKey(szLabel);
+		Open('[');
+	}
+
+	// list, which has no label line in text format
+	void BeginUnlabeledList(const char* szLabel)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+			return;
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+			pVisitor->BeginList(szLabel);
+		else
+			WriteKey(szLabel);
+		Open('[');
+	}
+
+	void EndList()
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+			return;
+
+		Close();
+	}
+
+	// item of the list
+	template <typename... T>
+	void Item(const T&... values)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print("\t", values..., "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Item(MakeValue(values...));
+			return;
+		}
+
+		BeginElement();
+		WriteValue(values...);
+	}
+
+	// item of the inline list, followed by the given separator in text format, if any
+	template <typename T>
+	void InlineItem(const T& value, const char chSeparator = '\0')
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Append(value);
+			if (chSeparator != '\0')
+				output.Append(chSeparator);
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Item(MakeTypedValue(value));
+			return;
+		}
+
+		BeginElement();
+		WriteTypedValue(value);
+	}
+
+	// item of the counted list
+	template <typename... T>
+	void NumberedItem(const std::size_t nNumber, const T&... values)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(nNumber, ". ", values..., "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Item(MakeValue(values...));
+			return;
+		}
+
+		BeginElement();
+		WriteValue(values...);
+	}
+
+	/*
+	 * record of the list, which fields are following, the first one on the numbered line, written as object in JSON
+	 * @param[in] nNumber number of the record, zero when fields of the record are written as the plain fields in text format
+	 */
+	void BeginRecord(const std::size_t nNumber)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			nPendingRecordNumber = nNumber;
+			bInRecord = (nNumber != 0U);
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->BeginRecord();
+			Open('(');
+			return;
+		}
+
+		BeginElement();
+		Open('{');
+	}
+
+	void EndRecord()
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			bInRecord = false;
+			return;
+		}
+
+		Close();
+	}
+
+	// handle item of the counted list, written as integer in JSON
+	void NumberedHandle(const std::size_t nNumber, const std::uint16_t uHandle, const char* szDescription)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print(nNumber, ". 0x", COutput::Hex(uHandle, 4), szDescription, "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor->Item(MakeHandleValue(uHandle));
+			return;
+		}
+
+		BeginElement();
+		output.Append(uHandle);
+	}
+
+	// append the output of the range emitter, that has been created from this one
+	void AppendRange(const COutput& outputRange)
+	{
+		if (outputRange.GetSize() == 0U)
+			return;
+
+		if (nFormat == OUTPUT_FORMAT_JSON)
+			BeginElement();
+
+		output.Append(COutput::String_t{ outputRange.GetData(), outputRange.GetSize() });
+	}
+
+	// error of the table decoding, written as '{ "error" }' document or element in JSON
+	template <typename... T>
+	void Error(const T&... values)
+	{
+		if (nFormat == OUTPUT_FORMAT_TEXT)
+		{
+			output.Print("[error] ", values..., "\n");
+			return;
+		}
+
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			output.Clear();
+			output.Print(values..., '\0');
+			pVisitor->Error(output.GetData());
+			return;
+		}
+
+		const bool bStandalone = (nDepth == 0U || nFormat == OUTPUT_FORMAT_NDJSON);
+		BeginElement();
+		Open('{');
+		if (bStandalone)
+			WriteHeaderMembers();
+		WriteKey("error");
+		WriteValue(values...);
+		Close();
+
+		if (bStandalone)
+			output.Append('\n');
+	}
+
+	// append the member name of the label, made of its lower case alphanumeric characters, separated by underscores
+	static void AppendKey(COutput& output, const char* szLabel)
+	{
+		bool bPendingSeparator = false;
+		bool bEmpty = true;
+		for (const char* pCurrent = szLabel; *pCurrent != '\0'; ++pCurrent)
+		{
+			char chCurrent = *pCurrent;
+			if (chCurrent >= 'A' && chCurrent <= 'Z')
+				chCurrent = static_cast<char>(chCurrent - 'A' + 'a');
+			else if (!((chCurrent >= 'a' && chCurrent <= 'z') || (chCurrent >= '0' && chCurrent <= '9')))
+			{
+				bPendingSeparator = true;
+				continue;
+			}
+
+			if (bPendingSeparator && !bEmpty)
+				output.Append('_');
+
+			output.Append(chCurrent);
+			bPendingSeparator = false;
+			bEmpty = false;
+		}
+	}
+
+	// append the string value, escaped as in JSON, null value is written as null
+	static void AppendString(COutput& output, const COutput::String_t string)
+	{
+		if (string.szValue == nullptr)
+		{
+			output.Append("null");
+			return;
+		}
+
+		output.Append('"');
+		for (std::size_t i = 0U; i < string.nLength; ++i)
+			AppendEscapedCharacter(output, string.szValue[i]);
+		output.Append('"');
+	}
+
+private:
+	// deepest scope of the JSON documents and visitor callbacks, deeper scopes are rejected
+	static constexpr std::size_t nMaxDepth = 8U;
+
+	/*
+	 * @param[in] chBracket opening bracket of the object or array, or '(' for the record in visitor format, that is an object as well otherwise
+	 * @remarks: scope nested deeper than the limit is rejected, it's written as null in JSON and reported empty to the visitor, and everything inside it is discarded
+	 */
+	void Open(const char chBracket)
+	{
+		if (nRejectedDepth > 0U || nDepth == nMaxDepth)
+		{
+			Reject(chBracket);
+			return;
+		}
+
+		// visitor is told about the scope by the caller, but it's tracked the same way to be closed with the matching callback
+		if (nFormat != OUTPUT_FORMAT_VISITOR)
+			output.Append(chBracket);
+
+		++nDepth;
+		arrClosingBracket[nDepth] = (chBracket == '{' ? '}' : (chBracket == '[' ? ']' : ')'));
+		arrNeedSeparator[nDepth] = false;
+	}
+
+	void Close()
+	{
+		if (nRejectedDepth > 0U)
+		{
+			if (--nRejectedDepth == 0U)
+				CloseRejected();
+			return;
+		}
+
+		WriteClosingBracket(arrClosingBracket[nDepth]);
+		--nDepth;
+	}
+
+	// start discarding the scope, that is nested deeper than the limit, with all scopes inside it
+	void Reject(const char chBracket)
+	{
+		if (nRejectedDepth++ > 0U)
+			return;
+
+		chRejectedClosingBracket = (chBracket == '{' ? '}' : (chBracket == '[' ? ']' : ')'));
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pRejectedVisitor = pVisitor;
+			pVisitor = &visitorRejected;
+		}
+		else
+		{
+			// member name or element separator has already been written, so the value must follow
+			output.Append("null");
+			nRejectedOffset = output.GetSize();
+		}
+	}
+
+	void CloseRejected()
+	{
+		if (nFormat == OUTPUT_FORMAT_VISITOR)
+		{
+			pVisitor = pRejectedVisitor;
+			WriteClosingBracket(chRejectedClosingBracket);
+		}
+		else
+			output.Truncate(nRejectedOffset);
+	}
+
+	void WriteClosingBracket(const char chClosingBracket)
+	{
+		if (nFormat != OUTPUT_FORMAT_VISITOR)
+			output.Append(chClosingBracket);
+		else if (chClosingBracket == '}')
+			pVisitor->EndGroup();
+		else if (chClosingBracket == ']')
+			pVisitor->EndList();
+		else
+			pVisitor->EndRecord();
+	}
+
+	void CloseTo(const std::size_t nTargetDepth)
+	{
+		while (nDepth > nTargetDepth)
+			Close();
+	}
+
+	// indent the field of the group or record in text format
+	void WriteIndentation()
+	{
+		for (std::size_t i = 0U; i < nGroupDepth; ++i)
+			output.Append('\t');
+
+		if (!bInRecord)
+			return;
+
+		// the first field of the record is numbered, the following ones are aligned to it
+		if (nPendingRecordNumber != 0U)
+		{
+			output.Print(nPendingRecordNumber, ". ");
+			nPendingRecordNumber = 0U;
+		}
+		else
+			output.Print("   ");
+	}
+
+	// separate the element of the current array or document from the previous one
+	void BeginElement()
+	{
+		if (nDepth == 0U)
+			return;
+
+		if (arrNeedSeparator[nDepth])
+			output.Append(',');
+		arrNeedSeparator[nDepth] = true;
+	}
+
+	// write member name of the label
+	void WriteKey(const char* szLabel)
+	{
+		BeginElement();
+		output.Append('"');
+		AppendKey(output, szLabel);
+		output.Print("\":");
+	}
+
+	// write the table version and the dump name, that are common to all documents
+	void WriteHeaderMembers()
+	{
+		if (szSource != nullptr)
+		{
+			WriteKey("source");
+			WriteString(szSource);
+		}
+
+		// version is unknown until the entry point is parsed
+		if (uVersion == 0U)
+			return;
+
+		WriteKey("version");
+		output.Print('"', (uVersion & 0xFF0000) >> 16U, ".", (uVersion & 0x00FF00) >> 8U, ".", (uVersion & 0x0000FF), '"');
+	}
+
+	void WriteString(const char* szValue)
+	{
+		if (szValue == nullptr)
+		{
+			output.Print("null");
+			return;
+		}
+
+		output.Append('"');
+		AppendEscaped(szValue);
+		output.Append('"');
+	}
+
+	template <typename T>
+	void WriteTypedValue(const T& value)
+	{
+		using Value_t = std::decay_t<T>;
+		if constexpr (std::is_same_v<Value_t, const char*> || std::is_same_v<Value_t, char*>)
+			WriteString(value);
+		else if constexpr (std::is_same_v<Value_t, COutput::String_t>)
+		{
+			if (value.szValue == nullptr)
+			{
+				output.Print("null");
+				return;
+			}
+
+			output.Append('"');
+			AppendEscaped(value);
+			output.Append('"');
+		}
+		else if constexpr (std::is_same_v<Value_t, bool>)
+			output.Print(value ? "true" : "false");
+		else if constexpr (std::is_same_v<Value_t, char>)
+		{
+			output.Append('"');
+			AppendEscaped(value);
+			output.Append('"');
+		}
+		else if constexpr (std::is_same_v<Value_t, COutput::Hex_t>)
+			output.Append(value.ullValue);
+		else
+			output.Append(value);
+	}
+
+	template <typename... T>
+	void WriteValue(const T&... values)
+	{
+		if constexpr (sizeof...(T) == 1U)
+			(WriteTypedValue(values), ...);
+		else
+		{
+			output.Append('"');
+			(AppendEscaped(values), ...);
+			output.Append('"');
+		}
+	}
+
+	// @returns: typed value for the visitor, single value keeps its type, otherwise the values are formatted to the string in the scratch buffer
+	template <typename... T>
+	DecodedValue_t MakeValue(const T&... values)
+	{
+		if constexpr (sizeof...(T) == 1U)
+			return MakeTypedValue(values...);
+		else
+		{
+			output.Clear();
+			output.Print(values...);
+
+			DecodedValue_t decodedValue;
+			decodedValue.nKind = VALUE_KIND_STRING;
+			decodedValue.pString = output.GetData();
+			decodedValue.nStringLength = output.GetSize();
+			return decodedValue;
+		}
+	}
+
+	template <typename T>
+	DecodedValue_t MakeTypedValue(const T& value)
+	{
+		using Value_t = std::decay_t<T>;
+
+		DecodedValue_t decodedValue;
+		if constexpr (std::is_same_v<Value_t, const char*> || std::is_same_v<Value_t, char*>)
+		{
+			// value may be the string literal as well
+			if (const char* szValue = value; szValue != nullptr)
+			{
+				decodedValue.nKind = VALUE_KIND_STRING;
+				decodedValue.pString = szValue;
+				decodedValue.nStringLength = std::strlen(szValue);
+			}
+		}
+		else if constexpr (std::is_same_v<Value_t, COutput::String_t>)
+		{
+			if (value.szValue != nullptr)
+			{
+				decodedValue.nKind = VALUE_KIND_STRING;
+				decodedValue.pString = value.szValue;
+				decodedValue.nStringLength = value.nLength;
+			}
+		}
+		else if constexpr (std::is_same_v<Value_t, bool>)
+		{
+			decodedValue.nKind = VALUE_KIND_BOOLEAN;
+			decodedValue.ullInteger = value;
+		}
+		else if constexpr (std::is_same_v<Value_t, char>)
+		{
+			decodedValue.nKind = VALUE_KIND_STRING;
+			decodedValue.pString = &value;
+			decodedValue.nStringLength = 1U;
+		}
+		else if constexpr (std::is_same_v<Value_t, COutput::Hex_t>)
+		{
+			decodedValue.nKind = VALUE_KIND_UNSIGNED;
+			decodedValue.ullInteger = value.ullValue;
+		}
+		else if constexpr (std::is_same_v<Value_t, COutput::Fixed_t>)
+		{
+			decodedValue.nKind = VALUE_KIND_REAL;
+			decodedValue.dReal = value.dValue;
+		}
+		else if constexpr (std::is_enum_v<Value_t>)
+		{
+			decodedValue.nKind = VALUE_KIND_UNSIGNED;
+			decodedValue.ullInteger = static_cast<std::uint64_t>(value);
+		}
+		else
+		{
+			decodedValue.nKind = (std::is_signed_v<Value_t> ? VALUE_KIND_SIGNED : VALUE_KIND_UNSIGNED);
+			decodedValue.ullInteger = static_cast<std::uint64_t>(value);
+		}
+
+		return decodedValue;
+	}
+
+	static DecodedValue_t MakeHandleValue(const std::uint16_t uHandle)
+	{
+		DecodedValue_t decodedValue;
+		decodedValue.nKind = VALUE_KIND_HANDLE;
+		decodedValue.ullInteger = uHandle;
+		return decodedValue;
+	}
+
+	void AppendEscaped(const char* szValue)
+	{
+		if (szValue == nullptr)
+			szValue = "(null)";
+
+		for (const char* pCurrent = szValue; *pCurrent != '\0'; ++pCurrent)
+			AppendEscaped(*pCurrent);
+	}
+
+	void AppendEscaped(const COutput::String_t string)
+	{
+		if (string.szValue == nullptr)
+		{
+			AppendEscaped("(null)");
+			return;
+		}
+
+		for (std::size_t i = 0U; i < string.nLength; ++i)
+			AppendEscaped(string.szValue[i]);
+	}
+
+	void AppendEscaped(const char chValue)
+	{
+		AppendEscapedCharacter(output, chValue);
+	}
+
+	static void AppendEscapedCharacter(COutput& output, const char chValue)
+	{
+		const auto uValue = static_cast<std::uint8_t>(chValue);
+		if (uValue == '"' || uValue == '\\')
+		{
+			output.Append('\\');
+			output.Append(chValue);
+		}
+		// strings aren't required to be in any particular encoding, so escape all non-ASCII characters as latin-1 to keep the document valid
+		else if (uValue < 0x20 || uValue >= 0x7F)
+			output.Print("\\u", COutput::Hex(uValue, 4));
+		else
+			output.Append(chValue);
+	}
+
+	// other values are formatted without any characters that need escaping
+	template <typename T>
+	void AppendEscaped(const T& value)
+	{
+		output.Append(value);
+	}
+
+	COutput& output;
+	const EOutputFormat nFormat;
+	const char* szSource = nullptr;
+	// receiver of the typed values in visitor format
+	IStructureVisitor* pVisitor = nullptr;
+	std::uint32_t uVersion = 0U;
+	// bracket that closes the object or array at the given depth
+	char arrClosingBracket[nMaxDepth + 1U] = { };
+	// whether the next element at the given depth needs to be separated from the previous one
+	bool arrNeedSeparator[nMaxDepth + 1U] = { };
+	std::size_t nDepth = 0U;
+	// count of the scopes, that are open inside and including the rejected one
+	std::size_t nRejectedDepth = 0U;
+	char chRejectedClosingBracket = '\0';
+	// size of the output, that is kept when the rejected scope is closed
+	std::size_t nRejectedOffset = 0U;
+	// receiver of the typed values in visitor format, that is restored when the rejected scope is closed
+	IStructureVisitor* pRejectedVisitor = nullptr;
+	// receiver that ignores the values inside the rejected scope
+	IStructureVisitor visitorRejected;
+	// depth of the structures array
+	std::size_t nStructureDepth = 0U;
+	// depth of the nested field groups in text format
+	std::size_t nGroupDepth = 0U;
+	// number of the current record, that is yet to be written in text format
+	std::size_t nPendingRecordNumber = 0U;
+	bool bInRecord = false;
+};
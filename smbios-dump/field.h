@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "emitter.h"
+#include "output.h"
+#include "visitor.h"
+
+/*
+ * visitor that keeps the first field with the given JSON member name, e.g. "serial_number", skipping all others
+ * @remarks: fields of the groups and records are matched as well. string of the kept value is copied, so it stays valid after the structure is visited
+ */
+class CFieldFinder : public IStructureVisitor
+{
+public:
+	explicit CFieldFinder(const char* szId) :
+		szId(szId), nIdLength(std::strlen(szId)) { }
+
+	void Field(const char* szLabel, const DecodedValue_t& value) override
+	{
+		if (bFound)
+			return;
+
+		outputKey.Clear();
+		CEmitter::AppendKey(outputKey, szLabel);
+		if (outputKey.GetSize() != nIdLength || std::memcmp(outputKey.GetData(), szId, nIdLength) != 0)
+			return;
+
+		bFound = true;
+		valueFound = value;
+
+		// the string may be formatted to the scratch buffer, that is reused by the next value
+		if (value.pString != nullptr)
+		{
+			strValue.assign(value.pString, value.nStringLength);
+			valueFound.pString = strValue.data();
+		}
+	}
+
+	// forget the found field, to search the next structure
+	void Reset()
+	{
+		bFound = false;
+	}
+
+	// @returns: found value, null if structure doesn't have the field
+	[[nodiscard]] const DecodedValue_t* GetValue() const
+	{
+		return bFound ? &valueFound : nullptr;
+	}
+
+private:
+	COutput outputKey { 64U };
+	const char* szId;
+	const std::size_t nIdLength;
+	bool bFound = false;
+	DecodedValue_t valueFound;
+	std::string strValue;
+};
@@ -0,0 +1,393 @@
+#include "health.h"
+
+#include <algorithm>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "resolver.h"
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+// offset right past the structure member, that must be covered by the structure length to be present
+#define SMB_FIELD_END(STRUCT, MEMBER) (SMB_FIELD_OFFSET(STRUCT, MEMBER) + sizeof(STRUCT::MEMBER))
+
+// names of the error information values, in order of their raw values starting from one
+constexpr const char* arrErrorType[] =
+{
+	"other",
+	"unknown",
+	"ok",
+	"bad_read",
+	"parity",
+	"single_bit",
+	"double_bit",
+	"multi_bit",
+	"nibble",
+	"checksum",
+	"crc",
+	"corrected_single_bit",
+	"corrected",
+	"uncorrectable"
+};
+
+constexpr const char* arrErrorGranularity[] =
+{
+	"other",
+	"unknown",
+	"device_level",
+	"memory_partition_level"
+};
+
+constexpr const char* arrErrorOperation[] =
+{
+	"other",
+	"unknown",
+	"read",
+	"write",
+	"partial_write"
+};
+
+// names of the health, in order of 'EMemoryHealth'
+constexpr const char* arrHealth[] =
+{
+	"ok",
+	"unknown",
+	"corrected",
+	"uncorrected"
+};
+
+constexpr const char* arrErrorSource[] =
+{
+	"handle",
+	"address"
+};
+
+// @returns: name of the raw value starting from one, or null when it's not listed
+template <std::size_t N>
+static const char* FindValueName(const char* const (&arrNames)[N], const std::uint8_t nValue)
+{
+	return (nValue >= 1U && nValue <= N) ? arrNames[nValue - 1U] : nullptr;
+}
+
+// @returns: health by the error type
+static EMemoryHealth GetErrorHealth(const std::uint8_t nType)
+{
+	switch (nType)
+	{
+	case 3U:
+		return MEMORY_HEALTH_OK;
+	// single-bit and nibble errors are corrected by the error correction code, and chipkill respectively
+	case 6U:
+	case 9U:
+	case 12U:
+	case 13U:
+		return MEMORY_HEALTH_CORRECTED;
+	case 4U:
+	case 5U:
+	case 7U:
+	case 8U:
+	case 10U:
+	case 11U:
+	case 14U:
+		return MEMORY_HEALTH_UNCORRECTED;
+	default:
+		return MEMORY_HEALTH_UNKNOWN;
+	}
+}
+
+/*
+ * read the memory 32-bit or 64-bit error information
+ * @returns: true if structure is the error information, false otherwise
+ */
+static bool ReadErrorRecord(const SMBIOS::StructureHeader_t* pStructure, MemoryErrorRecord_t* pRecord)
+{
+	// unknown address has only its highest bit set
+	if (pStructure->nType == SMBIOS::TYPE_MEMORY_32BIT_ERROR_INFORMATION && pStructure->nLength >= SMB_FIELD_END(SMBIOS::Memory32ErrorInformation_t, uDeviceErrorAddress))
+	{
+		const auto pMEI = reinterpret_cast<const SMBIOS::Memory32ErrorInformation_t*>(pStructure->arrData);
+		*pRecord = { pStructure->uHandle, ERROR_SOURCE_HANDLE, pMEI->nType, pMEI->nGranularity, pMEI->nOperation, pMEI->uVendorSyndrome,
+			pMEI->uArrayErrorAddress != 0x80000000 ? pMEI->uArrayErrorAddress : ~0ULL, pMEI->uDeviceErrorAddress != 0x80000000 ? pMEI->uDeviceErrorAddress : ~0ULL };
+		return true;
+	}
+
+	if (pStructure->nType == SMBIOS::TYPE_MEMORY_64BIT_ERROR_INFORMATION && pStructure->nLength >= SMB_FIELD_END(SMBIOS::Memory64ErrorInformation_t, ullDeviceErrorAddress))
+	{
+		const auto pMEI = reinterpret_cast<const SMBIOS::Memory64ErrorInformation_t*>(pStructure->arrData);
+		*pRecord = { pStructure->uHandle, ERROR_SOURCE_HANDLE, pMEI->nType, pMEI->nGranularity, pMEI->nOperation, pMEI->uVendorSyndrome,
+			pMEI->ullArrayErrorAddress != 0x8000000000000000ULL ? pMEI->ullArrayErrorAddress : ~0ULL, pMEI->ullDeviceErrorAddress != 0x8000000000000000ULL ? pMEI->ullDeviceErrorAddress : ~0ULL };
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * follow the error information handle of the device or array
+ * @param[out] pbHasError set when the handle references the error information, that is then read to the record
+ * @returns: health by the referenced error information, or unknown when it's not provided or not found
+ */
+static EMemoryHealth FollowErrorHandle(const CHandleIndex& handleIndex, const std::uint16_t uErrorHandle, std::vector<std::uint16_t>& vecReferencedHandles, bool* pbHasError, MemoryErrorRecord_t* pRecord)
+{
+	*pbHasError = false;
+
+	// special values tell that the information isn't provided, or that no error has been detected
+	if (uErrorHandle == 0xFFFE)
+		return MEMORY_HEALTH_UNKNOWN;
+	if (uErrorHandle == Q_SMBIOS_HANDLE_INVALID)
+		return MEMORY_HEALTH_OK;
+
+	const SMBIOS::StructureHeader_t* pError = handleIndex.Find(uErrorHandle);
+	if (pError == nullptr || !ReadErrorRecord(pError, pRecord))
+		return MEMORY_HEALTH_UNKNOWN;
+
+	vecReferencedHandles.push_back(uErrorHandle);
+	*pbHasError = true;
+	return GetErrorHealth(pRecord->nType);
+}
+
+const char* CMemoryHealth::GetHealthName(const EMemoryHealth nHealth)
+{
+	return arrHealth[nHealth];
+}
+
+void CMemoryHealth::Build(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize)
+{
+	vecDevices.clear();
+	vecArrays.clear();
+	nUnattributedCount = 0U;
+
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	// error information is referenced by the devices and arrays
+	CHandleIndex& handleIndex = state.handleIndex;
+	handleIndex.Reset(pTableData);
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+		handleIndex.Insert(reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]));
+
+	std::vector<std::uint16_t> vecReferencedHandles;
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType == SMBIOS::TYPE_PHYSICAL_MEMORY_ARRAY && pStructure->nLength >= SMB_FIELD_END(SMBIOS::PhysicalMemoryArray_t, uMemoryErrorInformationHandle))
+		{
+			const auto pPMA = reinterpret_cast<const SMBIOS::PhysicalMemoryArray_t*>(pStructure->arrData);
+
+			HealthArray_t array = { };
+			array.uHandle = pStructure->uHandle;
+			array.nHealth = FollowErrorHandle(handleIndex, pPMA->uMemoryErrorInformationHandle, vecReferencedHandles, &array.bHasError, &array.error);
+			vecArrays.push_back(array);
+			continue;
+		}
+
+		// empty slots don't have the health
+		if (pStructure->nType != SMBIOS::TYPE_MEMORY_DEVICE || pStructure->nLength < SMB_FIELD_END(SMBIOS::MemoryDevice_t, nBankLocator))
+			continue;
+
+		const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData);
+		if (pMD->nSize == 0U && pMD->nSizeGranulatiry == 0U)
+			continue;
+
+		CStringSet strings(pStructure, pTableData + vecBoundaries[i + 1U]);
+
+		HealthDevice_t device = { };
+		device.uHandle = pStructure->uHandle;
+		device.uArrayHandle = pMD->uPhysicalMemoryArrayHandle;
+		device.deviceLocator = strings.Get(pMD->nDeviceLocator);
+		device.bankLocator = strings.Get(pMD->nBankLocator);
+		if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::MemoryDevice_t, nPartNumber))
+		{
+			device.manufacturer = strings.Get(pMD->nManufacturer);
+			device.serialNumber = strings.Get(pMD->nSerialNumber);
+			device.partNumber = strings.Get(pMD->nPartNumber);
+		}
+		device.nHealth = FollowErrorHandle(handleIndex, pMD->uMemoryErrorInformationHandle, vecReferencedHandles, &device.bHasError, &device.error);
+		vecDevices.push_back(device);
+	}
+
+	std::sort(vecReferencedHandles.begin(), vecReferencedHandles.end());
+
+	// the rest of the error information is attributed by its address, that needs the mapped addresses
+	CAddressResolver resolver;
+	bool bResolverBuilt = false;
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		MemoryErrorRecord_t record;
+		if (!ReadErrorRecord(pStructure, &record) || std::binary_search(vecReferencedHandles.begin(), vecReferencedHandles.end(), record.uHandle))
+			continue;
+
+		// error information of no error doesn't need the attribution
+		const EMemoryHealth nHealth = GetErrorHealth(record.nType);
+		if (nHealth == MEMORY_HEALTH_OK)
+			continue;
+
+		if (!bResolverBuilt && record.ullArrayErrorAddress != ~0ULL)
+		{
+			// resolver rebuilds the structure boundaries of the same table, so they stay the same
+			resolver.Build(state, pTableData, nTableSize);
+			bResolverBuilt = true;
+		}
+
+		std::size_t nMappedCount = 0U;
+		const MappedDevice_t* pMappedDevices = (record.ullArrayErrorAddress != ~0ULL ? resolver.Resolve(record.ullArrayErrorAddress, &nMappedCount) : nullptr);
+		const auto itDevice = (nMappedCount == 1U ? std::find_if(vecDevices.begin(), vecDevices.end(), [pMappedDevices](const HealthDevice_t& device)
+		{
+			return device.uHandle == pMappedDevices->uDeviceHandle;
+		}) : vecDevices.end());
+
+		if (itDevice == vecDevices.end())
+		{
+			++nUnattributedCount;
+			continue;
+		}
+
+		// the most severe error is kept
+		if (!itDevice->bHasError || nHealth > GetErrorHealth(itDevice->error.nType))
+		{
+			itDevice->bHasError = true;
+			itDevice->error = record;
+			itDevice->error.nSource = ERROR_SOURCE_ADDRESS;
+		}
+		itDevice->nHealth = std::max(itDevice->nHealth, nHealth);
+	}
+
+	for (HealthArray_t& array : vecArrays)
+	{
+		array.nWorstHealth = array.nHealth;
+		for (const HealthDevice_t& device : vecDevices)
+		{
+			if (device.uArrayHandle != array.uHandle)
+				continue;
+
+			++array.arrDeviceCounts[device.nHealth];
+			array.nWorstHealth = std::max(array.nWorstHealth, device.nHealth);
+		}
+	}
+}
+
+// append the JSON object of the error information
+static void AppendErrorRecord(COutput& output, const MemoryErrorRecord_t& record)
+{
+	const auto fnAppendName = [&output](const char* szName)
+	{
+		if (szName != nullptr)
+			output.Print('"', szName, '"');
+		else
+			output.Append("null");
+	};
+
+	const auto fnAppendAddress = [&output](const std::uint64_t ullAddress)
+	{
+		if (ullAddress != ~0ULL)
+			output.Append(ullAddress);
+		else
+			output.Append("null");
+	};
+
+	output.Print("{\"handle\":", record.uHandle, ",\"source\":\"", arrErrorSource[record.nSource], "\",\"type\":");
+	fnAppendName(FindValueName(arrErrorType, record.nType));
+	output.Append(",\"granularity\":");
+	fnAppendName(FindValueName(arrErrorGranularity, record.nGranularity));
+	output.Append(",\"operation\":");
+	fnAppendName(FindValueName(arrErrorOperation, record.nOperation));
+	output.Print(",\"vendor_syndrome\":", record.uVendorSyndrome, ",\"array_address\":");
+	fnAppendAddress(record.ullArrayErrorAddress);
+	output.Append(",\"device_address\":");
+	fnAppendAddress(record.ullDeviceErrorAddress);
+	output.Append('}');
+}
+
+// append the error information as the text, e.g. "corrected_single_bit, handle 0x1800"
+static void AppendErrorRecordText(COutput& output, const MemoryErrorRecord_t& record)
+{
+	const char* szType = FindValueName(arrErrorType, record.nType);
+	output.Print(szType != nullptr ? szType : "reserved", ", handle 0x", COutput::Hex(record.uHandle, 4));
+	if (record.nSource == ERROR_SOURCE_ADDRESS)
+		output.Append(", by address");
+	if (record.ullArrayErrorAddress != ~0ULL)
+		output.Print(", address 0x", COutput::Hex(record.ullArrayErrorAddress, 16));
+}
+
+void CMemoryHealth::AppendReport(COutput& output, const EOutputFormat nFormat) const
+{
+	EMemoryHealth nSystemHealth = MEMORY_HEALTH_OK;
+	for (const HealthArray_t& array : vecArrays)
+		nSystemHealth = std::max(nSystemHealth, array.nWorstHealth);
+	for (const HealthDevice_t& device : vecDevices)
+		nSystemHealth = std::max(nSystemHealth, device.nHealth);
+
+	if (nFormat == OUTPUT_FORMAT_TEXT)
+	{
+		output.Print("Health: ", arrHealth[nSystemHealth], "\nUnattributed Errors: ", nUnattributedCount, '\n');
+		for (const HealthArray_t& array : vecArrays)
+		{
+			output.Print("\n[Memory Array 0x", COutput::Hex(array.uHandle, 4), "]\nHealth: ", arrHealth[array.nWorstHealth], "\nArray Error: ");
+			if (array.bHasError)
+				AppendErrorRecordText(output, array.error);
+			else
+				output.Append(arrHealth[array.nHealth]);
+
+			output.Print("\nDevices: ", array.arrDeviceCounts[MEMORY_HEALTH_OK], " ok, ", array.arrDeviceCounts[MEMORY_HEALTH_UNKNOWN], " unknown, ", array.arrDeviceCounts[MEMORY_HEALTH_CORRECTED], " corrected, ", array.arrDeviceCounts[MEMORY_HEALTH_UNCORRECTED], " uncorrected\n");
+			for (const HealthDevice_t& device : vecDevices)
+			{
+				if (device.uArrayHandle != array.uHandle)
+					continue;
+
+				output.Print('\t', device.deviceLocator.szValue != nullptr ? device.deviceLocator : COutput::String_t{ "Not Specified", 13U }, ": ", arrHealth[device.nHealth]);
+				if (device.bHasError)
+				{
+					output.Append(" (");
+					AppendErrorRecordText(output, device.error);
+					output.Append(')');
+				}
+
+				if (device.partNumber.szValue != nullptr)
+					output.Print(", ", device.manufacturer.szValue != nullptr ? device.manufacturer : COutput::String_t{ "Not Specified", 13U }, ' ', device.partNumber);
+				output.Append('\n');
+			}
+		}
+
+		return;
+	}
+
+	// the document fits the single line, so it's the same for both JSON formats
+	output.Print("{\"health\":\"", arrHealth[nSystemHealth], "\",\"unattributed_errors\":", nUnattributedCount, ",\"arrays\":[");
+	for (std::size_t i = 0U; i < vecArrays.size(); ++i)
+	{
+		const HealthArray_t& array = vecArrays[i];
+		output.Print(i > 0U ? ",{\"array_handle\":" : "{\"array_handle\":", array.uHandle, ",\"health\":\"", arrHealth[array.nWorstHealth], "\",\"array_health\":\"", arrHealth[array.nHealth], "\",\"error\":");
+		if (array.bHasError)
+			AppendErrorRecord(output, array.error);
+		else
+			output.Append("null");
+
+		output.Print(",\"ok_devices\":", array.arrDeviceCounts[MEMORY_HEALTH_OK], ",\"unknown_devices\":", array.arrDeviceCounts[MEMORY_HEALTH_UNKNOWN], ",\"corrected_devices\":", array.arrDeviceCounts[MEMORY_HEALTH_CORRECTED], ",\"uncorrected_devices\":", array.arrDeviceCounts[MEMORY_HEALTH_UNCORRECTED], '}');
+	}
+	output.Append("],\"devices\":[");
+
+	for (std::size_t i = 0U; i < vecDevices.size(); ++i)
+	{
+		const HealthDevice_t& device = vecDevices[i];
+		output.Print(i > 0U ? ",{\"handle\":" : "{\"handle\":", device.uHandle, ",\"array_handle\":", device.uArrayHandle, ",\"locator\":");
+		CEmitter::AppendString(output, device.deviceLocator);
+		output.Append(",\"bank_locator\":");
+		CEmitter::AppendString(output, device.bankLocator);
+		output.Append(",\"manufacturer\":");
+		CEmitter::AppendString(output, device.manufacturer);
+		output.Append(",\"part_number\":");
+		CEmitter::AppendString(output, device.partNumber);
+		output.Append(",\"serial_number\":");
+		CEmitter::AppendString(output, device.serialNumber);
+		output.Print(",\"health\":\"", arrHealth[device.nHealth], "\",\"error\":");
+		if (device.bHasError)
+			AppendErrorRecord(output, device.error);
+		else
+			output.Append("null");
+		output.Append('}');
+	}
+	output.Append("]}\n");
+}
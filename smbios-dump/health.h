@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "decode.h"
+#include "emitter.h"
+#include "output.h"
+
+// health of the memory device or array by the most severe error reported for it, in order of the severity
+enum EMemoryHealth : std::uint8_t
+{
+	// no error has been detected, or the error information tells so
+	MEMORY_HEALTH_OK = 0,
+	// error information isn't provided, or it doesn't tell the error
+	MEMORY_HEALTH_UNKNOWN,
+	MEMORY_HEALTH_CORRECTED,
+	MEMORY_HEALTH_UNCORRECTED,
+	MEMORY_HEALTH_COUNT
+};
+
+// how the error information has been attributed to the memory device
+enum EErrorSource : std::uint8_t
+{
+	// referenced by the error information handle of the device or array
+	ERROR_SOURCE_HANDLE = 0,
+	// not referenced by any structure, but its array error address is mapped only to the device
+	ERROR_SOURCE_ADDRESS
+};
+
+// memory 32-bit or 64-bit error information
+struct MemoryErrorRecord_t
+{
+	std::uint16_t uHandle;
+	EErrorSource nSource;
+	// raw values of the structure
+	std::uint8_t nType;
+	std::uint8_t nGranularity;
+	std::uint8_t nOperation;
+	std::uint32_t uVendorSyndrome;
+	// ~0 when they're unknown
+	std::uint64_t ullArrayErrorAddress;
+	std::uint64_t ullDeviceErrorAddress;
+};
+
+// populated memory device with its errors
+struct HealthDevice_t
+{
+	std::uint16_t uHandle;
+	std::uint16_t uArrayHandle;
+	// strings of the memory device, referencing the table, with null value when they're not specified
+	COutput::String_t deviceLocator;
+	COutput::String_t bankLocator;
+	COutput::String_t manufacturer;
+	COutput::String_t partNumber;
+	COutput::String_t serialNumber;
+	EMemoryHealth nHealth;
+	// the most severe error attributed to the device, valid when 'bHasError' is set
+	bool bHasError;
+	MemoryErrorRecord_t error;
+};
+
+// physical memory array with the errors of itself and of its devices
+struct HealthArray_t
+{
+	std::uint16_t uHandle;
+	// health of the array by its own error information
+	EMemoryHealth nHealth;
+	bool bHasError;
+	MemoryErrorRecord_t error;
+	// the most severe of the array and its devices
+	EMemoryHealth nWorstHealth;
+	// count of the populated devices of each health
+	std::uint32_t arrDeviceCounts[MEMORY_HEALTH_COUNT];
+};
+
+/*
+ * health of the memory devices and arrays, that follows their error information handles to the memory 32-bit and 64-bit error information structures
+ * @remarks: error information, that isn't referenced by any structure, is attributed to the device its array error address is mapped to, unless the address is unknown or interleaved between the devices.
+ * health references the table strings, so the table must outlive it
+ */
+class CMemoryHealth
+{
+public:
+	// build the health of the given table, replacing the previous one
+	void Build(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize);
+	// append the health of each array and populated device, either as the text or as the JSON document
+	void AppendReport(COutput& output, EOutputFormat nFormat) const;
+
+	[[nodiscard]] const std::vector<HealthDevice_t>& GetDevices() const
+	{
+		return vecDevices;
+	}
+
+	[[nodiscard]] const std::vector<HealthArray_t>& GetArrays() const
+	{
+		return vecArrays;
+	}
+
+	// @returns: name of the health for the reports, e.g. "corrected"
+	[[nodiscard]] static const char* GetHealthName(EMemoryHealth nHealth);
+
+private:
+	std::vector<HealthDevice_t> vecDevices;
+	std::vector<HealthArray_t> vecArrays;
+	// count of the error information structures, that haven't been attributed to any device or array
+	std::size_t nUnattributedCount = 0U;
+};
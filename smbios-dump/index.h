@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include <q-tee/smbios/smbios.h>
+
+/*
+ * direct-mapped index of the structures of a single table by their handles, for constant time cross-reference resolution
+ * @remarks: entries are stamped with the generation of the table they belong to, so the index is reset between tables without clearing it
+ */
+class CHandleIndex
+{
+public:
+	// reset the index to the new table, entries are allocated at the first use
+	void Reset(const std::uint8_t* pNewTableData)
+	{
+		pTableData = pNewTableData;
+
+		if (pEntries == nullptr)
+			pEntries.reset(new Entry_t[nEntryCount]());
+
+		// clear the entries only once the generation counter wraps around
+		if (++uGeneration == 0U)
+		{
+			std::memset(pEntries.get(), 0, sizeof(Entry_t) * nEntryCount);
+			uGeneration = 1U;
+		}
+	}
+
+	// add the structure of the current table to the index, when structure handle is duplicated, the first structure is kept
+	void Insert(const SMBIOS::StructureHeader_t* pStructure)
+	{
+		Entry_t& entry = pEntries[pStructure->uHandle];
+		if (entry.uGeneration == uGeneration)
+			return;
+
+		entry.uOffset = static_cast<std::uint32_t>(reinterpret_cast<const std::uint8_t*>(pStructure) - pTableData);
+		entry.nType = pStructure->nType;
+		entry.uGeneration = uGeneration;
+	}
+
+	// @returns: structure of the current table with the given handle, null if it's not present
+	[[nodiscard]] const SMBIOS::StructureHeader_t* Find(const std::uint16_t uHandle) const
+	{
+		if (pEntries == nullptr || pEntries[uHandle].uGeneration != uGeneration)
+			return nullptr;
+
+		const Entry_t& entry = pEntries[uHandle];
+
+		return reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + entry.uOffset);
+	}
+
+	/*
+	 * get type of the structure with the given handle, without accessing the table
+	 * @returns: true if structure is present, false otherwise
+	 */
+	bool FindType(const std::uint16_t uHandle, std::uint8_t* pnType) const
+	{
+		if (pEntries == nullptr || pEntries[uHandle].uGeneration != uGeneration)
+			return false;
+
+		const Entry_t& entry = pEntries[uHandle];
+
+		*pnType = entry.nType;
+		return true;
+	}
+
+private:
+	static constexpr std::size_t nEntryCount = 0x10000;
+
+	struct Entry_t
+	{
+		std::uint32_t uOffset;
+		std::uint8_t nType;
+		std::uint16_t uGeneration;
+	};
+
+	std::unique_ptr<Entry_t[]> pEntries;
+	const std::uint8_t* pTableData = nullptr;
+	std::uint16_t uGeneration = 0U;
+};
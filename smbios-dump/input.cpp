@@ -0,0 +1,474 @@
+#include "input.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <q-tee/common/common.h>
+
+#if defined(Q_OS_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+struct RawSMBIOSData_t
+{
+	BYTE Used20CallingMethod;
+	BYTE SMBIOSMajorVersion;
+	BYTE SMBIOSMinorVersion;
+	BYTE DmiRevision;
+	DWORD Length;
+	BYTE SMBIOSTableData[];
+};
+#elif defined(Q_OS_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#error "target platform is not supported!"
+#endif
+
+// size of the buffer at first acquisition, enough for the tables of most machines
+constexpr std::size_t nInitialBufferSize = 64U * 1024U;
+// offset of the structure table in the buffer, entry point is placed before it
+constexpr std::size_t nTableBufferOffset = 0x40;
+
+// report the acquisition error to the given file, unless it's null
+template <typename... T>
+static void ReportError(FILE* hOutput, const char* szFormat, const T... values)
+{
+	if (hOutput != nullptr)
+		std::fprintf(hOutput, szFormat, values...);
+}
+
+CTableReader::~CTableReader()
+{
+	UnmapFile();
+	delete[] pBuffer;
+}
+
+void CTableReader::ReserveBuffer(const std::size_t nSize, const std::size_t nKeepSize)
+{
+	if (nSize <= nBufferSize)
+		return;
+
+	std::size_t nNewBufferSize = (nBufferSize > 0U ? nBufferSize : nInitialBufferSize);
+	while (nNewBufferSize < nSize)
+		nNewBufferSize *= 2U;
+
+	std::uint8_t* pNewBuffer = new std::uint8_t[nNewBufferSize];
+	if (nKeepSize > 0U)
+		std::memcpy(pNewBuffer, pBuffer, nKeepSize);
+
+	delete[] pBuffer;
+	pBuffer = pNewBuffer;
+	nBufferSize = nNewBufferSize;
+}
+
+#if defined(Q_OS_WINDOWS)
+bool CTableReader::ReadFileToBuffer(FILE* hOutput, [[maybe_unused]] const int iDirectory, const char* szFilePath, const std::size_t nBufferOffset, std::size_t* pnFileSize)
+{
+	const HANDLE hFile = ::CreateFileA(szFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	++statistics.ullSyscallCount;
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	ReserveBuffer(nBufferOffset + 1U, nBufferOffset);
+
+	// read until the end of file, growing the buffer when it's filled
+	std::size_t nFileSize = 0U;
+	bool bSucceeded = true;
+	while (true)
+	{
+		if (nBufferOffset + nFileSize == nBufferSize)
+			ReserveBuffer(nBufferSize + 1U, nBufferOffset + nFileSize);
+
+		const std::size_t nRequestSize = nBufferSize - nBufferOffset - nFileSize;
+		DWORD dwReadSize = 0UL;
+		++statistics.ullSyscallCount;
+		if (::ReadFile(hFile, pBuffer + nBufferOffset + nFileSize, nRequestSize > MAXDWORD ? MAXDWORD : static_cast<DWORD>(nRequestSize), &dwReadSize, nullptr) == FALSE)
+		{
+			ReportError(hOutput, "[error] failed to read file: %s\n", szFilePath);
+			bSucceeded = false;
+			break;
+		}
+
+		if (dwReadSize == 0UL)
+			break;
+
+		nFileSize += dwReadSize;
+	}
+
+	::CloseHandle(hFile);
+	++statistics.ullSyscallCount;
+
+	statistics.ullReadByteCount += nFileSize;
+	*pnFileSize = nFileSize;
+	return bSucceeded;
+}
+
+bool CTableReader::ReadLive(FILE* hOutput, TableView_t* pView)
+{
+	const std::uint32_t nSmBiosDataSize = ::GetSystemFirmwareTable('RSMB', 0UL, nullptr, 0UL);
+	++statistics.ullSyscallCount;
+	if (nSmBiosDataSize == 0U)
+	{
+		ReportError(hOutput, "[error] failed to get size of firmware table\n");
+		return false;
+	}
+
+	ReserveBuffer(nSmBiosDataSize, 0U);
+
+	++statistics.ullSyscallCount;
+	if (::GetSystemFirmwareTable('RSMB', 0UL, pBuffer, nSmBiosDataSize) == 0UL)
+	{
+		ReportError(hOutput, "[error] failed to get firmware table\n");
+		return false;
+	}
+
+	statistics.ullReadByteCount += nSmBiosDataSize;
+
+	const auto pRawSmBiosData = reinterpret_cast<const RawSMBIOSData_t*>(pBuffer);
+	const std::size_t nAvailableSize = nSmBiosDataSize - Q_OFFSETOF(RawSMBIOSData_t, SMBIOSTableData);
+
+	pView->pEntryPoint = nullptr;
+	pView->nEntryPointSize = 0U;
+	pView->pTable = pRawSmBiosData->SMBIOSTableData;
+	pView->nTableSize = pRawSmBiosData->Length < nAvailableSize ? pRawSmBiosData->Length : nAvailableSize;
+	pView->uVersion = (pRawSmBiosData->SMBIOSMajorVersion << 16U) | (pRawSmBiosData->SMBIOSMinorVersion << 8U) | pRawSmBiosData->DmiRevision;
+	return true;
+}
+
+bool CTableReader::MapFile(FILE* hOutput, const char* szFilePath, const std::uint8_t** ppData, std::size_t* pnDataSize)
+{
+	UnmapFile();
+
+	const HANDLE hFile = ::CreateFileA(szFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	++statistics.ullSyscallCount;
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	++statistics.ullSyscallCount;
+	if (::GetFileSizeEx(hFile, &fileSize) == FALSE || fileSize.QuadPart <= 0LL)
+	{
+		ReportError(hOutput, "[error] failed to get size of file or it is empty: %s\n", szFilePath);
+		::CloseHandle(hFile);
+		++statistics.ullSyscallCount;
+		return false;
+	}
+
+	// mapped view keeps the mapping object alive, so both handles can be closed right after
+	const HANDLE hMapping = ::CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0UL, 0UL, nullptr);
+	++statistics.ullSyscallCount;
+	void* pData = nullptr;
+	if (hMapping != nullptr)
+	{
+		pData = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0UL, 0UL, 0U);
+		++statistics.ullSyscallCount;
+		::CloseHandle(hMapping);
+		++statistics.ullSyscallCount;
+	}
+
+	::CloseHandle(hFile);
+	++statistics.ullSyscallCount;
+
+	if (pData == nullptr)
+	{
+		ReportError(hOutput, "[error] failed to map file: %s\n", szFilePath);
+		return false;
+	}
+
+	pMappedData = pData;
+	nMappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+	statistics.ullMappedByteCount += nMappedSize;
+
+	*ppData = static_cast<const std::uint8_t*>(pMappedData);
+	*pnDataSize = nMappedSize;
+	return true;
+}
+
+bool CTableReader::MapFileRange(FILE* hOutput, const char* szFilePath, const std::uint64_t ullOffset, const std::size_t nSize, const std::uint8_t** ppData)
+{
+	UnmapFile();
+
+	const HANDLE hFile = ::CreateFileA(szFilePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	++statistics.ullSyscallCount;
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	++statistics.ullSyscallCount;
+	if (::GetFileSizeEx(hFile, &fileSize) == FALSE || nSize == 0U || ullOffset + nSize > static_cast<std::uint64_t>(fileSize.QuadPart))
+	{
+		ReportError(hOutput, "[error] range exceeds the file: %s\n", szFilePath);
+		::CloseHandle(hFile);
+		++statistics.ullSyscallCount;
+		return false;
+	}
+
+	// view must begin at the allocation granularity
+	SYSTEM_INFO systemInfo;
+	::GetSystemInfo(&systemInfo);
+	const std::uint64_t ullViewOffset = ullOffset - ullOffset % systemInfo.dwAllocationGranularity;
+	const std::size_t nViewSize = static_cast<std::size_t>(ullOffset - ullViewOffset) + nSize;
+
+	const HANDLE hMapping = ::CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0UL, 0UL, nullptr);
+	++statistics.ullSyscallCount;
+	void* pData = nullptr;
+	if (hMapping != nullptr)
+	{
+		pData = ::MapViewOfFile(hMapping, FILE_MAP_READ, static_cast<DWORD>(ullViewOffset >> 32U), static_cast<DWORD>(ullViewOffset), nViewSize);
+		++statistics.ullSyscallCount;
+		::CloseHandle(hMapping);
+		++statistics.ullSyscallCount;
+	}
+
+	::CloseHandle(hFile);
+	++statistics.ullSyscallCount;
+
+	if (pData == nullptr)
+	{
+		ReportError(hOutput, "[error] failed to map file: %s\n", szFilePath);
+		return false;
+	}
+
+	pMappedData = pData;
+	nMappedSize = nViewSize;
+	statistics.ullMappedByteCount += nMappedSize;
+
+	*ppData = static_cast<const std::uint8_t*>(pMappedData) + (ullOffset - ullViewOffset);
+	return true;
+}
+
+void CTableReader::UnmapFile()
+{
+	if (pMappedData == nullptr)
+		return;
+
+	::UnmapViewOfFile(pMappedData);
+	++statistics.ullSyscallCount;
+	pMappedData = nullptr;
+	nMappedSize = 0U;
+}
+#elif defined(Q_OS_LINUX)
+bool CTableReader::ReadFileToBuffer(FILE* hOutput, const int iDirectory, const char* szFilePath, const std::size_t nBufferOffset, std::size_t* pnFileSize)
+{
+	const int iFile = ::openat(iDirectory, szFilePath, O_RDONLY | O_CLOEXEC);
+	++statistics.ullSyscallCount;
+	if (iFile < 0)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	ReserveBuffer(nBufferOffset + 1U, nBufferOffset);
+
+	// sysfs doesn't always report the actual size of attributes, so read until the end of file, growing the buffer when it's filled
+	std::size_t nFileSize = 0U;
+	bool bSucceeded = true;
+	while (true)
+	{
+		if (nBufferOffset + nFileSize == nBufferSize)
+			ReserveBuffer(nBufferSize + 1U, nBufferOffset + nFileSize);
+
+		const ssize_t nReadSize = ::pread(iFile, pBuffer + nBufferOffset + nFileSize, nBufferSize - nBufferOffset - nFileSize, static_cast<off_t>(nFileSize));
+		++statistics.ullSyscallCount;
+		if (nReadSize < 0)
+		{
+			ReportError(hOutput, "[error] failed to read file: %s\n", szFilePath);
+			bSucceeded = false;
+			break;
+		}
+
+		if (nReadSize == 0)
+			break;
+
+		nFileSize += static_cast<std::size_t>(nReadSize);
+	}
+
+	::close(iFile);
+	++statistics.ullSyscallCount;
+
+	statistics.ullReadByteCount += nFileSize;
+	*pnFileSize = nFileSize;
+	return bSucceeded;
+}
+
+bool CTableReader::ReadLive(FILE* hOutput, TableView_t* pView)
+{
+	constexpr const char* szTablesDirectoryPath = "/sys/firmware/dmi/tables";
+	const int iDirectory = ::open(szTablesDirectoryPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	++statistics.ullSyscallCount;
+	if (iDirectory < 0)
+	{
+		ReportError(hOutput, "[error] failed to open tables directory: %s\n", szTablesDirectoryPath);
+		return false;
+	}
+
+	std::size_t nEntryPointSize = 0U, nTableSize = 0U;
+	bool bSucceeded = ReadFileToBuffer(hOutput, iDirectory, "smbios_entry_point", 0U, &nEntryPointSize);
+	if (bSucceeded && nEntryPointSize > nTableBufferOffset)
+	{
+		ReportError(hOutput, "[error] entry point file is too large: %s/smbios_entry_point\n", szTablesDirectoryPath);
+		bSucceeded = false;
+	}
+
+	if (bSucceeded)
+		bSucceeded = ReadFileToBuffer(hOutput, iDirectory, "DMI", nTableBufferOffset, &nTableSize);
+
+	::close(iDirectory);
+	++statistics.ullSyscallCount;
+
+	if (!bSucceeded)
+		return false;
+
+	pView->pEntryPoint = pBuffer;
+	pView->nEntryPointSize = nEntryPointSize;
+	pView->pTable = pBuffer + nTableBufferOffset;
+	pView->nTableSize = nTableSize;
+	pView->uVersion = 0U;
+	return true;
+}
+
+bool CTableReader::MapFile(FILE* hOutput, const char* szFilePath, const std::uint8_t** ppData, std::size_t* pnDataSize)
+{
+	UnmapFile();
+
+	const int iFile = ::open(szFilePath, O_RDONLY | O_CLOEXEC);
+	++statistics.ullSyscallCount;
+	if (iFile < 0)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	struct stat info;
+	++statistics.ullSyscallCount;
+	if (::fstat(iFile, &info) != 0 || info.st_size <= 0)
+	{
+		ReportError(hOutput, "[error] failed to get size of file or it is empty: %s\n", szFilePath);
+		::close(iFile);
+		++statistics.ullSyscallCount;
+		return false;
+	}
+
+	// mapping stays valid after the descriptor is closed
+	void* pData = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, iFile, 0);
+	++statistics.ullSyscallCount;
+	::close(iFile);
+	++statistics.ullSyscallCount;
+
+	if (pData == MAP_FAILED)
+	{
+		ReportError(hOutput, "[error] failed to map file: %s\n", szFilePath);
+		return false;
+	}
+
+	pMappedData = pData;
+	nMappedSize = static_cast<std::size_t>(info.st_size);
+	statistics.ullMappedByteCount += nMappedSize;
+
+	*ppData = static_cast<const std::uint8_t*>(pMappedData);
+	*pnDataSize = nMappedSize;
+	return true;
+}
+
+bool CTableReader::MapFileRange(FILE* hOutput, const char* szFilePath, const std::uint64_t ullOffset, const std::size_t nSize, const std::uint8_t** ppData)
+{
+	UnmapFile();
+
+	const int iFile = ::open(szFilePath, O_RDONLY | O_CLOEXEC);
+	++statistics.ullSyscallCount;
+	if (iFile < 0)
+	{
+		ReportError(hOutput, "[error] failed to open file: %s\n", szFilePath);
+		return false;
+	}
+
+	// accessing the mapping past the end of regular file raises the signal, while the device files have no size
+	struct stat info;
+	++statistics.ullSyscallCount;
+	if (::fstat(iFile, &info) != 0 || nSize == 0U || (S_ISREG(info.st_mode) && ullOffset + nSize > static_cast<std::uint64_t>(info.st_size)))
+	{
+		ReportError(hOutput, "[error] range exceeds the file: %s\n", szFilePath);
+		::close(iFile);
+		++statistics.ullSyscallCount;
+		return false;
+	}
+
+	// mapping must begin at the page boundary
+	const std::uint64_t ullPageSize = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+	const std::uint64_t ullMappingOffset = ullOffset - ullOffset % ullPageSize;
+	const std::size_t nMappingSize = static_cast<std::size_t>(ullOffset - ullMappingOffset) + nSize;
+
+	// physical memory can be mapped only as shared
+	void* pData = ::mmap(nullptr, nMappingSize, PROT_READ, MAP_SHARED, iFile, static_cast<off_t>(ullMappingOffset));
+	++statistics.ullSyscallCount;
+	::close(iFile);
+	++statistics.ullSyscallCount;
+
+	if (pData == MAP_FAILED)
+	{
+		ReportError(hOutput, "[error] failed to map file: %s\n", szFilePath);
+		return false;
+	}
+
+	pMappedData = pData;
+	nMappedSize = nMappingSize;
+	statistics.ullMappedByteCount += nMappedSize;
+
+	*ppData = static_cast<const std::uint8_t*>(pMappedData) + (ullOffset - ullMappingOffset);
+	return true;
+}
+
+void CTableReader::UnmapFile()
+{
+	if (pMappedData == nullptr)
+		return;
+
+	::munmap(pMappedData, nMappedSize);
+	++statistics.ullSyscallCount;
+	pMappedData = nullptr;
+	nMappedSize = 0U;
+}
+#endif
+
+bool CTableReader::ReadFiles(FILE* hOutput, const char* szEntryPointFilePath, const char* szTableFilePath, TableView_t* pView)
+{
+#if defined(Q_OS_LINUX)
+	constexpr int iDirectory = AT_FDCWD;
+#else
+	constexpr int iDirectory = 0;
+#endif
+
+	std::size_t nEntryPointSize = 0U, nTableSize = 0U;
+	if (!ReadFileToBuffer(hOutput, iDirectory, szEntryPointFilePath, 0U, &nEntryPointSize))
+		return false;
+
+	if (nEntryPointSize > nTableBufferOffset)
+	{
+		ReportError(hOutput, "[error] entry point file is too large: %s\n", szEntryPointFilePath);
+		return false;
+	}
+
+	if (!ReadFileToBuffer(hOutput, iDirectory, szTableFilePath, nTableBufferOffset, &nTableSize))
+		return false;
+
+	pView->pEntryPoint = pBuffer;
+	pView->nEntryPointSize = nEntryPointSize;
+	pView->pTable = pBuffer + nTableBufferOffset;
+	pView->nTableSize = nTableSize;
+	pView->uVersion = 0U;
+	return true;
+}
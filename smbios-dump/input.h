@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// non-owning view of the acquired tables, valid until the next acquisition or destruction of the reader
+struct TableView_t
+{
+	// entry point data, null when it's not available, e.g. with windows firmware tables
+	const std::uint8_t* pEntryPoint = nullptr;
+	std::size_t nEntryPointSize = 0U;
+	// structure table data
+	const std::uint8_t* pTable = nullptr;
+	std::size_t nTableSize = 0U;
+	// SMBIOS version, valid only when the entry point is not available
+	std::uint32_t uVersion = 0U;
+};
+
+// cost of the acquisition since the reader creation
+struct AcquisitionStatistics_t
+{
+	std::uint64_t ullSyscallCount = 0ULL;
+	std::uint64_t ullReadByteCount = 0ULL;
+	std::uint64_t ullMappedByteCount = 0ULL;
+};
+
+/*
+ * reader of the SMBIOS tables, that reads files into a single buffer, reused between acquisitions and grown only when needed, or maps them to memory
+ * @remarks: reader isn't thread-safe, use separate instance for each thread. errors are reported to the given 'hOutput' file, unless it's null
+ */
+class CTableReader
+{
+public:
+	CTableReader() = default;
+	~CTableReader();
+
+	CTableReader(const CTableReader&) = delete;
+	CTableReader& operator=(const CTableReader&) = delete;
+
+	/*
+	 * read the entry point and structure table of the current machine
+	 * @returns: true if tables have been read, false otherwise
+	 */
+	bool ReadLive(FILE* hOutput, TableView_t* pView);
+	/*
+	 * read the entry point and structure table from the separate files, as they're exposed by sysfs
+	 * @returns: true if both files have been read, false otherwise
+	 */
+	bool ReadFiles(FILE* hOutput, const char* szEntryPointFilePath, const char* szTableFilePath, TableView_t* pView);
+	/*
+	 * map the whole file into memory for reading
+	 * @returns: true if file has been mapped, false otherwise
+	 */
+	bool MapFile(FILE* hOutput, const char* szFilePath, const std::uint8_t** ppData, std::size_t* pnDataSize);
+	/*
+	 * map the given range of the file into memory for reading, e.g. of the physical memory file '/dev/mem'
+	 * @returns: true if range has been mapped, false otherwise, also when it exceeds the regular file
+	 */
+	bool MapFileRange(FILE* hOutput, const char* szFilePath, std::uint64_t ullOffset, std::size_t nSize, const std::uint8_t** ppData);
+	// unmap the currently mapped file, if any
+	void UnmapFile();
+
+	[[nodiscard]] const AcquisitionStatistics_t& GetStatistics() const
+	{
+		return statistics;
+	}
+
+private:
+	// grow the buffer to hold at least the given size, keeping the first 'nKeepSize' bytes
+	void ReserveBuffer(std::size_t nSize, std::size_t nKeepSize);
+	/*
+	 * read the whole file to the buffer at the given offset
+	 * @param[in] iDirectory descriptor of the directory, relative to which the file path is resolved
+	 * @returns: true if file has been read, false otherwise
+	 */
+	bool ReadFileToBuffer(FILE* hOutput, int iDirectory, const char* szFilePath, std::size_t nBufferOffset, std::size_t* pnFileSize);
+
+	std::uint8_t* pBuffer = nullptr;
+	std::size_t nBufferSize = 0U;
+	// mapping begins at the page boundary, that may precede the mapped range
+	void* pMappedData = nullptr;
+	std::size_t nMappedSize = 0U;
+	AcquisitionStatistics_t statistics = { };
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// value of the sparse enumeration and its name
+struct EnumName_t
+{
+	std::uint32_t uValue;
+	const char* szName;
+};
+
+/*
+ * compile-time dense lookup table of the sparse enumeration names, indexed by the offset of the value from the smallest one
+ * @remarks: table stores only the positions of the names for the whole range of values, so gaps between the values cost a byte each
+ */
+template <std::uint32_t uFirstValue, std::size_t nValueRange, std::size_t nNameCount>
+class CEnumNameTable
+{
+public:
+	constexpr explicit CEnumNameTable(const EnumName_t (&arrEnumNames)[nNameCount])
+	{
+		for (std::size_t i = 0U; i < nNameCount; ++i)
+		{
+			arrPositions[arrEnumNames[i].uValue - uFirstValue] = static_cast<Position_t>(i + 1U);
+			arrNames[i] = arrEnumNames[i].szName;
+		}
+	}
+
+	// @returns: name of the given value, or the default name if value isn't listed
+	[[nodiscard]] constexpr const char* Find(const std::uint32_t uValue, const char* szDefault = "Reserved") const
+	{
+		// values below the first one wrap around and are rejected by the same comparison
+		const std::uint32_t uOffset = uValue - uFirstValue;
+		if (uOffset >= nValueRange || arrPositions[uOffset] == 0U)
+			return szDefault;
+
+		return arrNames[arrPositions[uOffset] - 1U];
+	}
+
+private:
+	// position of the name plus one, or zero if value isn't listed
+	using Position_t = std::conditional_t<(nNameCount < 0xFF), std::uint8_t, std::uint16_t>;
+
+	Position_t arrPositions[nValueRange] = { };
+	const char* arrNames[nNameCount] = { };
+};
+
+template <std::size_t N>
+[[nodiscard]] consteval bool HasDuplicateEnumValues(const EnumName_t (&arrEnumNames)[N])
+{
+	for (std::size_t i = 0U; i < N; ++i)
+	{
+		for (std::size_t j = i + 1U; j < N; ++j)
+		{
+			if (arrEnumNames[i].uValue == arrEnumNames[j].uValue)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * build the lookup table from the list of value and name pairs, that may be in any order
+ * @remarks: list must have static storage duration, so it's checked at compile time
+ */
+template <const auto& arrEnumNames>
+[[nodiscard]] consteval auto MakeEnumNameTable()
+{
+	static_assert(!HasDuplicateEnumValues(arrEnumNames), "enumeration value is listed more than once");
+
+	constexpr auto uMinValue = []()
+	{
+		std::uint32_t uValue = arrEnumNames[0].uValue;
+		for (const EnumName_t& enumName : arrEnumNames)
+			uValue = (enumName.uValue < uValue ? enumName.uValue : uValue);
+		return uValue;
+	}();
+
+	constexpr auto uMaxValue = []()
+	{
+		std::uint32_t uValue = arrEnumNames[0].uValue;
+		for (const EnumName_t& enumName : arrEnumNames)
+			uValue = (enumName.uValue > uValue ? enumName.uValue : uValue);
+		return uValue;
+	}();
+
+	static_assert(uMaxValue - uMinValue < 0x10000, "range of the enumeration values is too wide for the dense table");
+
+	return CEnumNameTable<uMinValue, static_cast<std::size_t>(uMaxValue - uMinValue) + 1U, sizeof(arrEnumNames) / sizeof(arrEnumNames[0])>(arrEnumNames);
+}
+
+// @returns: name of the given value from the lookup table of the list, that is built once at compile time
+template <const auto& arrEnumNames>
+[[nodiscard]] const char* FindEnumName(const std::uint32_t uValue, const char* szDefault = "Reserved")
+{
+	static constexpr auto enumNameTable = MakeEnumNameTable<arrEnumNames>();
+	return enumNameTable.Find(uValue, szDefault);
+}
@@ -0,0 +1,205 @@
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+/*
+ * text writer, that formats values into a growable buffer, which is then written out at once
+ * @remarks: formatting produces exactly the same text as the corresponding printf conversions
+ */
+class COutput
+{
+public:
+	// value formatted as '%0<width>X'
+	struct Hex_t
+	{
+		std::uint64_t ullValue;
+		std::uint8_t nWidth;
+	};
+
+	// value formatted as '%.<precision>f'
+	struct Fixed_t
+	{
+		double dValue;
+		std::uint8_t nPrecision;
+	};
+
+	// string of the known length formatted as '%s', null value is formatted as glibc does
+	struct String_t
+	{
+		const char* szValue;
+		std::size_t nLength;
+	};
+
+	explicit COutput(const std::size_t nInitialCapacity = 64U * 1024U) :
+		pBuffer(new char[nInitialCapacity]), nCapacity(nInitialCapacity) { }
+
+	~COutput()
+	{
+		delete[] pBuffer;
+	}
+
+	COutput(const COutput&) = delete;
+	COutput& operator=(const COutput&) = delete;
+
+	template <typename T>
+	[[nodiscard]] static constexpr Hex_t Hex(const T value, const std::uint8_t nWidth)
+	{
+		// convert to the unsigned type of the same size, as printf does
+		if constexpr (std::is_enum_v<T>)
+			return { static_cast<std::make_unsigned_t<std::underlying_type_t<T>>>(value), nWidth };
+		else
+			return { static_cast<std::make_unsigned_t<decltype(+value)>>(value), nWidth };
+	}
+
+	[[nodiscard]] static constexpr Fixed_t Fixed(const double dValue, const std::uint8_t nPrecision)
+	{
+		return { dValue, nPrecision };
+	}
+
+	// append all values in order
+	template <typename... T>
+	void Print(const T&... values)
+	{
+		(Append(values), ...);
+	}
+
+	void Append(const char* szValue)
+	{
+		// glibc printf outputs null strings this way, keep it to match the previous output
+		if (szValue == nullptr)
+			szValue = "(null)";
+
+		const std::size_t nLength = std::strlen(szValue);
+		std::memcpy(Reserve(nLength), szValue, nLength);
+		nSize += nLength;
+	}
+
+	void Append(const String_t string)
+	{
+		if (string.szValue == nullptr)
+		{
+			Append("(null)");
+			return;
+		}
+
+		std::memcpy(Reserve(string.nLength), string.szValue, string.nLength);
+		nSize += string.nLength;
+	}
+
+	void Append(const char chValue)
+	{
+		*Reserve(1U) = chValue;
+		++nSize;
+	}
+
+	void Append(const bool bValue)
+	{
+		Append(bValue ? '1' : '0');
+	}
+
+	template <typename T> requires (std::is_integral_v<T> || std::is_enum_v<T>)
+	void Append(const T value)
+	{
+		constexpr std::size_t nMaxLength = 24U;
+		char* pBegin = Reserve(nMaxLength);
+
+		std::to_chars_result result;
+		if constexpr (std::is_enum_v<T>)
+			result = std::to_chars(pBegin, pBegin + nMaxLength, static_cast<std::underlying_type_t<T>>(value));
+		else
+			result = std::to_chars(pBegin, pBegin + nMaxLength, +value);
+
+		nSize += static_cast<std::size_t>(result.ptr - pBegin);
+	}
+
+	void Append(const Hex_t hex)
+	{
+		constexpr char arrDigits[] = "0123456789ABCDEF";
+
+		std::uint8_t nDigitCount = 1U;
+		for (std::uint64_t ullValue = hex.ullValue >> 4U; ullValue != 0ULL; ullValue >>= 4U)
+			++nDigitCount;
+
+		const std::uint8_t nLength = (nDigitCount > hex.nWidth ? nDigitCount : hex.nWidth);
+		char* pBegin = Reserve(nLength);
+
+		std::uint64_t ullValue = hex.ullValue;
+		for (char* pCurrent = pBegin + nLength; pCurrent != pBegin; ullValue >>= 4U)
+			*--pCurrent = arrDigits[ullValue & 0xF];
+
+		nSize += nLength;
+	}
+
+	void Append(const Fixed_t fixed)
+	{
+		// enough for any finite double in fixed notation
+		constexpr std::size_t nMaxLength = 512U;
+		char* pBegin = Reserve(nMaxLength);
+
+		const std::to_chars_result result = std::to_chars(pBegin, pBegin + nMaxLength, fixed.dValue, std::chars_format::fixed, fixed.nPrecision);
+		nSize += static_cast<std::size_t>(result.ptr - pBegin);
+	}
+
+	[[nodiscard]] const char* GetData() const
+	{
+		return pBuffer;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const
+	{
+		return nSize;
+	}
+
+	// discard all buffered text, keeping the allocated buffer
+	void Clear()
+	{
+		nSize = 0U;
+	}
+
+	// discard the buffered text after the given size, that has been returned by 'GetSize' before
+	void Truncate(const std::size_t nNewSize)
+	{
+		if (nNewSize < nSize)
+			nSize = nNewSize;
+	}
+
+	/*
+	 * write all buffered text to the file with a single call and clear the buffer
+	 * @returns: true if all text has been written, false otherwise
+	 */
+	bool Flush(FILE* hFile)
+	{
+		const bool bSucceeded = (nSize == 0U || std::fwrite(pBuffer, 1U, nSize, hFile) == nSize);
+		nSize = 0U;
+		return bSucceeded;
+	}
+
+private:
+	// @returns: pointer to the end of text, where at least given count of characters can be written
+	char* Reserve(const std::size_t nCount)
+	{
+		if (nSize + nCount > nCapacity)
+		{
+			std::size_t nNewCapacity = (nCapacity > 0U ? nCapacity * 2U : 64U);
+			while (nSize + nCount > nNewCapacity)
+				nNewCapacity *= 2U;
+
+			char* pNewBuffer = new char[nNewCapacity];
+			std::memcpy(pNewBuffer, pBuffer, nSize);
+			delete[] pBuffer;
+
+			pBuffer = pNewBuffer;
+			nCapacity = nNewCapacity;
+		}
+
+		return pBuffer + nSize;
+	}
+
+	char* pBuffer = nullptr;
+	std::size_t nSize = 0U;
+	std::size_t nCapacity = 0U;
+};
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * pool of worker threads that run a fixed range of tasks, where each worker owns a queue of task indices
+ * initially filled with a contiguous range, pops tasks from its front, so its own range runs in order, and, once it's empty, steals tasks from the back of other workers queues
+ * @remarks: the set of tasks is known before the run, so a worker may exit as soon as all queues are observed empty
+ */
+class CWorkStealingPool
+{
+public:
+	explicit CWorkStealingPool(const std::size_t nWorkerCount) :
+		vecQueues(nWorkerCount > 0U ? nWorkerCount : 1U) { }
+
+	CWorkStealingPool(const CWorkStealingPool&) = delete;
+	CWorkStealingPool& operator=(const CWorkStealingPool&) = delete;
+
+	[[nodiscard]] std::size_t GetWorkerCount() const
+	{
+		return vecQueues.size();
+	}
+
+	/*
+	 * run the task for each index in range [0, nTaskCount) and wait for all of them to complete
+	 * @param[in] fnTask callable with signature 'void(std::size_t nTaskIndex, std::size_t nWorkerIndex)'
+	 * @remarks: calling thread participates as the worker with index 0
+	 */
+	template <typename T>
+	void Run(const std::size_t nTaskCount, T&& fnTask)
+	{
+		const std::size_t nWorkerCount = vecQueues.size();
+
+		// distribute tasks evenly, so the stealing happens only when workers are out of balance
+		for (std::size_t i = 0U; i < nWorkerCount; ++i)
+		{
+			const std::size_t nBegin = nTaskCount * i / nWorkerCount;
+			const std::size_t nEnd = nTaskCount * (i + 1U) / nWorkerCount;
+
+			WorkerQueue_t& queue = vecQueues[i];
+			queue.deqTasks.clear();
+			for (std::size_t nTaskIndex = nBegin; nTaskIndex < nEnd; ++nTaskIndex)
+				queue.deqTasks.push_back(nTaskIndex);
+		}
+
+		const auto fnWorker = [this, &fnTask](const std::size_t nWorkerIndex)
+		{
+			std::size_t nTaskIndex;
+			while (PopTask(nWorkerIndex, &nTaskIndex) || StealTask(nWorkerIndex, &nTaskIndex))
+				fnTask(nTaskIndex, nWorkerIndex);
+		};
+
+		std::vector<std::thread> vecThreads;
+		vecThreads.reserve(nWorkerCount - 1U);
+		for (std::size_t i = 1U; i < nWorkerCount; ++i)
+			vecThreads.emplace_back(fnWorker, i);
+
+		fnWorker(0U);
+
+		for (std::thread& thread : vecThreads)
+			thread.join();
+	}
+
+private:
+	// pop the lowest queued task index of the own queue
+	bool PopTask(const std::size_t nWorkerIndex, std::size_t* pnTaskIndex)
+	{
+		WorkerQueue_t& queue = vecQueues[nWorkerIndex];
+		std::lock_guard lock(queue.mutex);
+		if (queue.deqTasks.empty())
+			return false;
+
+		*pnTaskIndex = queue.deqTasks.front();
+		queue.deqTasks.pop_front();
+		return true;
+	}
+
+	// steal the highest queued task index of the other workers, which their owners would reach last, starting from the next one to spread contention
+	bool StealTask(const std::size_t nWorkerIndex, std::size_t* pnTaskIndex)
+	{
+		const std::size_t nWorkerCount = vecQueues.size();
+		for (std::size_t i = 1U; i < nWorkerCount; ++i)
+		{
+			WorkerQueue_t& queue = vecQueues[(nWorkerIndex + i) % nWorkerCount];
+			std::lock_guard lock(queue.mutex);
+			if (queue.deqTasks.empty())
+				continue;
+
+			*pnTaskIndex = queue.deqTasks.back();
+			queue.deqTasks.pop_back();
+			return true;
+		}
+
+		return false;
+	}
+
+	// align to the cache line to avoid false sharing between the workers
+	struct alignas(64) WorkerQueue_t
+	{
+		std::mutex mutex;
+		std::deque<std::size_t> deqTasks;
+	};
+
+	std::vector<WorkerQueue_t> vecQueues;
+};
@@ -0,0 +1,394 @@
+#include "processor.h"
+
+#include <algorithm>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "emitter.h"
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+// offset right past the structure member, that must be covered by the structure length to be present
+#define SMB_FIELD_END(STRUCT, MEMBER) (SMB_FIELD_OFFSET(STRUCT, MEMBER) + sizeof(STRUCT::MEMBER))
+
+// processor type of the central processors, the others, e.g. math or video processors, don't run the threads
+constexpr std::uint8_t PROCESSOR_TYPE_CENTRAL = 3U;
+
+// names of the cache values, in order of their raw values starting from one, or from zero for the operational mode
+constexpr const char* arrCacheAssociativity[] =
+{
+	"other",
+	"unknown",
+	"direct_mapped",
+	"set_associative",
+	"set_associative",
+	"fully_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative",
+	"set_associative"
+};
+constexpr std::uint8_t arrCacheWays[] =
+{
+	0U, 0U, 1U, 2U, 4U, 0U, 8U, 16U, 12U, 24U, 32U, 48U, 64U, 20U
+};
+constexpr const char* arrCacheType[] =
+{
+	"other",
+	"unknown",
+	"instruction",
+	"data",
+	"unified"
+};
+constexpr const char* arrCachePolicy[] =
+{
+	"write_through",
+	"write_back",
+	"varies",
+	"unknown"
+};
+
+static_assert(Q_ARRAYSIZE(arrCacheAssociativity) == Q_ARRAYSIZE(arrCacheWays));
+
+static const char* GetCacheAssociativity(const ProcessorCache_t& cache)
+{
+	return cache.nAssociativity == 0U || cache.nAssociativity > Q_ARRAYSIZE(arrCacheAssociativity) ? "unknown" : arrCacheAssociativity[cache.nAssociativity - 1U];
+}
+
+static const char* GetCacheType(const ProcessorCache_t& cache)
+{
+	return cache.nSystemCacheType == 0U || cache.nSystemCacheType > Q_ARRAYSIZE(arrCacheType) ? "unknown" : arrCacheType[cache.nSystemCacheType - 1U];
+}
+
+// fill the cache from the cache information structure
+static void ReadCache(const SMBIOS::StructureHeader_t* pStructure, ProcessorCache_t& cache)
+{
+	const auto pCI = reinterpret_cast<const SMBIOS::CacheInformation_t*>(pStructure->arrData);
+	cache.uHandle = pStructure->uHandle;
+	cache.bEnabled = pCI->bEnabled;
+	cache.nOperationalMode = static_cast<std::uint8_t>(pCI->nOperationalMode);
+
+	// extended sizes are the bit-fields following the associativity, they're present since 3.1 and hold the size of any cache
+	if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::CacheInformation_t, nAssociativity) + 2U * sizeof(std::uint32_t))
+		cache.ullSizeKiB = (pCI->nInstalledSizeExtendedGranularity ? static_cast<std::uint64_t>(pCI->nInstalledSizeExtended) * 64U : pCI->nInstalledSizeExtended);
+	else
+		cache.ullSizeKiB = (pCI->nInstalledSizeGranularity ? static_cast<std::uint64_t>(pCI->nInstalledSize) * 64U : pCI->nInstalledSize);
+
+	if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::CacheInformation_t, nAssociativity))
+	{
+		cache.nSystemCacheType = pCI->nSystemCacheType;
+		cache.nAssociativity = pCI->nAssociativity;
+		cache.nWays = (pCI->nAssociativity == 0U || pCI->nAssociativity > Q_ARRAYSIZE(arrCacheWays) ? 0U : arrCacheWays[pCI->nAssociativity - 1U]);
+	}
+}
+
+void CProcessorSummary::Build(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize)
+{
+	vecSockets.clear();
+
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	// caches are referenced by the processors
+	CHandleIndex& handleIndex = state.handleIndex;
+	handleIndex.Reset(pTableData);
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+		handleIndex.Insert(reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]));
+
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType != SMBIOS::TYPE_PROCESSOR_INFORMATION || pStructure->nLength < SMB_FIELD_END(SMBIOS::ProcessorInformation_t, nUpgrade))
+			continue;
+
+		const auto pPI = reinterpret_cast<const SMBIOS::ProcessorInformation_t*>(pStructure->arrData);
+		if (pPI->nType != PROCESSOR_TYPE_CENTRAL)
+			continue;
+
+		CStringSet strings(pStructure, pTableData + vecBoundaries[i + 1U]);
+
+		ProcessorSocket_t socket = { };
+		socket.uHandle = pStructure->uHandle;
+		socket.designation = strings.Get(pPI->nSocketDesignation);
+		socket.manufacturer = strings.Get(pPI->nManufacturer);
+		socket.version = strings.Get(pPI->nVersion);
+		socket.bPopulated = pPI->bSocketPopulated;
+		socket.uMaxSpeed = pPI->uMaxSpeed;
+		socket.uCurrentSpeed = pPI->uCurrentSpeed;
+
+		for (ProcessorCache_t& cache : socket.arrCaches)
+			cache.uHandle = 0xFFFF;
+
+		if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::ProcessorInformation_t, uL3CacheHandle))
+		{
+			const std::uint16_t arrCacheHandles[] = { pPI->uL1CacheHandle, pPI->uL2CacheHandle, pPI->uL3CacheHandle };
+			for (std::size_t j = 0U; j < Q_ARRAYSIZE(arrCacheHandles); ++j)
+			{
+				// cache that is described by the structure too short for its sizes is left out
+				if (const SMBIOS::StructureHeader_t* pCache = handleIndex.Find(arrCacheHandles[j]); pCache != nullptr && pCache->nType == SMBIOS::TYPE_CACHE_INFORMATION && pCache->nLength >= SMB_FIELD_END(SMBIOS::CacheInformation_t, uCurrentSRAMType))
+					ReadCache(pCache, socket.arrCaches[j]);
+			}
+		}
+
+		if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::ProcessorInformation_t, nThreadCount))
+		{
+			socket.nCoreCount = pPI->nCoreCount;
+			socket.nCoreEnabled = pPI->nCoreEnabled;
+			socket.nThreadCount = pPI->nThreadCount;
+
+			// counts above 254 are stored only by the extended fields
+			if (pStructure->nLength >= SMB_FIELD_END(SMBIOS::ProcessorInformation_t, nThreadCountExtended))
+			{
+				if (socket.nCoreCount == 0xFF)
+					socket.nCoreCount = pPI->nCoreCountExtended;
+				if (socket.nCoreEnabled == 0xFF)
+					socket.nCoreEnabled = pPI->nCoreEnabledExtended;
+				if (socket.nThreadCount == 0xFF)
+					socket.nThreadCount = pPI->nThreadCountExtended;
+			}
+		}
+
+		vecSockets.push_back(socket);
+	}
+}
+
+void CProcessorSummary::Append(COutput& output, const ESummaryFormat nFormat) const
+{
+	switch (nFormat)
+	{
+	case SUMMARY_FORMAT_JSON:
+		AppendJson(output);
+		break;
+	case SUMMARY_FORMAT_ENV:
+		AppendEnvironment(output);
+		break;
+	case SUMMARY_FORMAT_HEADER:
+		AppendHeader(output);
+		break;
+	}
+}
+
+// totals of the populated sockets
+struct ProcessorTotals_t
+{
+	std::size_t nPopulatedCount = 0U;
+	std::uint32_t nCoreCount = 0U;
+	std::uint32_t nCoreEnabled = 0U;
+	std::uint32_t nThreadCount = 0U;
+	// smallest installed size of each cache level, zero when it's unknown for any of the sockets
+	std::uint64_t arrMinCacheSizeKiB[3] = { };
+};
+
+static ProcessorTotals_t GetTotals(const std::vector<ProcessorSocket_t>& vecSockets)
+{
+	ProcessorTotals_t totals;
+	bool bFirst = true;
+	for (const ProcessorSocket_t& socket : vecSockets)
+	{
+		if (!socket.bPopulated)
+			continue;
+
+		++totals.nPopulatedCount;
+		totals.nCoreCount += socket.nCoreCount;
+		totals.nCoreEnabled += socket.nCoreEnabled;
+		totals.nThreadCount += socket.nThreadCount;
+
+		for (std::size_t i = 0U; i < Q_ARRAYSIZE(totals.arrMinCacheSizeKiB); ++i)
+			totals.arrMinCacheSizeKiB[i] = (bFirst ? socket.arrCaches[i].ullSizeKiB : std::min(totals.arrMinCacheSizeKiB[i], socket.arrCaches[i].ullSizeKiB));
+
+		bFirst = false;
+	}
+
+	return totals;
+}
+
+// append the value, or null when it's unknown
+template <typename T>
+static void AppendKnown(COutput& output, const T value)
+{
+	if (value == 0U)
+		output.Append("null");
+	else
+		output.Append(value);
+}
+
+void CProcessorSummary::AppendJson(COutput& output) const
+{
+	const ProcessorTotals_t totals = GetTotals(vecSockets);
+	output.Print("{\"sockets\":", vecSockets.size(), ",\"populated_sockets\":", totals.nPopulatedCount, ",\"cores\":", totals.nCoreCount, ",\"enabled_cores\":", totals.nCoreEnabled, ",\"threads\":", totals.nThreadCount, ",\"processors\":[");
+
+	for (std::size_t i = 0U; i < vecSockets.size(); ++i)
+	{
+		const ProcessorSocket_t& socket = vecSockets[i];
+		output.Print(i > 0U ? ",{\"handle\":" : "{\"handle\":", socket.uHandle, ",\"socket\":");
+		CEmitter::AppendString(output, socket.designation);
+		output.Append(",\"manufacturer\":");
+		CEmitter::AppendString(output, socket.manufacturer);
+		output.Append(",\"version\":");
+		CEmitter::AppendString(output, socket.version);
+		output.Print(",\"populated\":", socket.bPopulated ? "true" : "false", ",\"cores\":");
+		AppendKnown(output, socket.nCoreCount);
+		output.Append(",\"enabled_cores\":");
+		AppendKnown(output, socket.nCoreEnabled);
+		output.Append(",\"threads\":");
+		AppendKnown(output, socket.nThreadCount);
+		output.Append(",\"max_speed_mhz\":");
+		AppendKnown(output, socket.uMaxSpeed);
+		output.Append(",\"current_speed_mhz\":");
+		AppendKnown(output, socket.uCurrentSpeed);
+		output.Append(",\"caches\":[");
+
+		bool bFirstCache = true;
+		for (std::size_t j = 0U; j < Q_ARRAYSIZE(socket.arrCaches); ++j)
+		{
+			const ProcessorCache_t& cache = socket.arrCaches[j];
+			if (cache.uHandle == 0xFFFF)
+				continue;
+
+			output.Print(bFirstCache ? "{\"level\":" : ",{\"level\":", j + 1U, ",\"handle\":", cache.uHandle, ",\"enabled\":", cache.bEnabled ? "true" : "false", ",\"size_kib\":");
+			AppendKnown(output, cache.ullSizeKiB);
+			output.Append(",\"ways\":");
+			AppendKnown(output, cache.nWays);
+			output.Print(",\"associativity\":\"", GetCacheAssociativity(cache), "\",\"type\":\"", GetCacheType(cache), "\",\"policy\":\"", arrCachePolicy[cache.nOperationalMode], "\"}");
+			bFirstCache = false;
+		}
+		output.Append("]}");
+	}
+	output.Append("]}\n");
+}
+
+void CProcessorSummary::AppendEnvironment(COutput& output) const
+{
+	// only the numbers and the names without spaces are written, so the values don't need quoting, unknown numbers are zero
+	const ProcessorTotals_t totals = GetTotals(vecSockets);
+	output.Print("SMBIOS_PROCESSOR_SOCKETS=", vecSockets.size(), "\nSMBIOS_PROCESSOR_POPULATED_SOCKETS=", totals.nPopulatedCount, "\nSMBIOS_PROCESSOR_CORES=", totals.nCoreCount, "\nSMBIOS_PROCESSOR_ENABLED_CORES=", totals.nCoreEnabled, "\nSMBIOS_PROCESSOR_THREADS=", totals.nThreadCount, '\n');
+	for (std::size_t i = 0U; i < Q_ARRAYSIZE(totals.arrMinCacheSizeKiB); ++i)
+		output.Print("SMBIOS_PROCESSOR_MIN_L", i + 1U, "_SIZE_KIB=", totals.arrMinCacheSizeKiB[i], '\n');
+
+	for (std::size_t i = 0U; i < vecSockets.size(); ++i)
+	{
+		const ProcessorSocket_t& socket = vecSockets[i];
+		output.Print("SMBIOS_PROCESSOR_", i, "_POPULATED=", socket.bPopulated, '\n');
+		output.Print("SMBIOS_PROCESSOR_", i, "_CORES=", socket.nCoreCount, '\n');
+		output.Print("SMBIOS_PROCESSOR_", i, "_ENABLED_CORES=", socket.nCoreEnabled, '\n');
+		output.Print("SMBIOS_PROCESSOR_", i, "_THREADS=", socket.nThreadCount, '\n');
+		output.Print("SMBIOS_PROCESSOR_", i, "_MAX_SPEED_MHZ=", socket.uMaxSpeed, '\n');
+		output.Print("SMBIOS_PROCESSOR_", i, "_CURRENT_SPEED_MHZ=", socket.uCurrentSpeed, '\n');
+
+		for (std::size_t j = 0U; j < Q_ARRAYSIZE(socket.arrCaches); ++j)
+		{
+			const ProcessorCache_t& cache = socket.arrCaches[j];
+			if (cache.uHandle == 0xFFFF)
+				continue;
+
+			output.Print("SMBIOS_PROCESSOR_", i, "_L", j + 1U, "_SIZE_KIB=", cache.ullSizeKiB, '\n');
+			output.Print("SMBIOS_PROCESSOR_", i, "_L", j + 1U, "_WAYS=", cache.nWays, '\n');
+			output.Print("SMBIOS_PROCESSOR_", i, "_L", j + 1U, "_ASSOCIATIVITY=", GetCacheAssociativity(cache), '\n');
+			output.Print("SMBIOS_PROCESSOR_", i, "_L", j + 1U, "_TYPE=", GetCacheType(cache), '\n');
+			output.Print("SMBIOS_PROCESSOR_", i, "_L", j + 1U, "_POLICY=", arrCachePolicy[cache.nOperationalMode], '\n');
+		}
+	}
+}
+
+// append the C++ string literal, or 'nullptr' when string is not specified
+static void AppendLiteral(COutput& output, const COutput::String_t string)
+{
+	if (string.szValue == nullptr)
+	{
+		output.Append("nullptr");
+		return;
+	}
+
+	constexpr char arrDigits[] = "01234567";
+	output.Append('"');
+	for (std::size_t i = 0U; i < string.nLength; ++i)
+	{
+		const auto uCharacter = static_cast<std::uint8_t>(string.szValue[i]);
+		if (uCharacter == '"' || uCharacter == '\\')
+			output.Print('\\', static_cast<char>(uCharacter));
+		// octal escape of the fixed length doesn't absorb the following digits
+		else if (uCharacter < 0x20U || uCharacter >= 0x7FU)
+			output.Print('\\', arrDigits[uCharacter >> 6U], arrDigits[(uCharacter >> 3U) & 7U], arrDigits[uCharacter & 7U]);
+		else
+			output.Append(static_cast<char>(uCharacter));
+	}
+	output.Append('"');
+}
+
+void CProcessorSummary::AppendHeader(COutput& output) const
+{
+	const ProcessorTotals_t totals = GetTotals(vecSockets);
+	output.Append(
+		"// generated by smbios-dump '--cpu-summary header', do not edit\n"
+		"#pragma once\n"
+		"#include <array>\n"
+		"#include <cstddef>\n"
+		"#include <cstdint>\n"
+		"\n"
+		"namespace SMBIOS_HOST\n"
+		"{\n"
+		"\t// cache of the single level, numbers are zero when they're unknown\n"
+		"\tstruct Cache_t\n"
+		"\t{\n"
+		"\t\tbool bPresent;\n"
+		"\t\tbool bEnabled;\n"
+		"\t\tstd::uint64_t ullSizeKiB;\n"
+		"\t\tstd::uint32_t nWays;\n"
+		"\t\tconst char* szAssociativity;\n"
+		"\t\tconst char* szType;\n"
+		"\t\tconst char* szPolicy;\n"
+		"\t};\n"
+		"\n"
+		"\t// central processor socket, numbers are zero when they're unknown\n"
+		"\tstruct Processor_t\n"
+		"\t{\n"
+		"\t\tconst char* szSocket;\n"
+		"\t\tbool bPopulated;\n"
+		"\t\tstd::uint32_t nCoreCount;\n"
+		"\t\tstd::uint32_t nCoreEnabled;\n"
+		"\t\tstd::uint32_t nThreadCount;\n"
+		"\t\tstd::uint32_t uMaxSpeedMHz;\n"
+		"\t\tstd::uint32_t uCurrentSpeedMHz;\n"
+		"\t\t// L1, L2 and L3 caches\n"
+		"\t\tCache_t arrCaches[3];\n"
+		"\t};\n"
+		"\n");
+
+	output.Print("\tinline constexpr std::size_t nSocketCount = ", vecSockets.size(), "U;\n");
+	output.Print("\t// totals of the populated sockets\n");
+	output.Print("\tinline constexpr std::size_t nPopulatedSocketCount = ", totals.nPopulatedCount, "U;\n");
+	output.Print("\tinline constexpr std::uint32_t nCoreCount = ", totals.nCoreCount, "U;\n");
+	output.Print("\tinline constexpr std::uint32_t nCoreEnabled = ", totals.nCoreEnabled, "U;\n");
+	output.Print("\tinline constexpr std::uint32_t nThreadCount = ", totals.nThreadCount, "U;\n");
+	output.Print("\t// smallest installed size of each cache level among the populated sockets, zero when it's unknown for any of them\n");
+	for (std::size_t i = 0U; i < Q_ARRAYSIZE(totals.arrMinCacheSizeKiB); ++i)
+		output.Print("\tinline constexpr std::uint64_t ullMinL", i + 1U, "SizeKiB = ", totals.arrMinCacheSizeKiB[i], "U;\n");
+
+	output.Append("\n\tinline constexpr std::array<Processor_t, nSocketCount> arrProcessors =\n\t{ {\n");
+	for (const ProcessorSocket_t& socket : vecSockets)
+	{
+		output.Append("\t\t{ ");
+		AppendLiteral(output, socket.designation);
+		output.Print(", ", socket.bPopulated ? "true" : "false", ", ", socket.nCoreCount, "U, ", socket.nCoreEnabled, "U, ", socket.nThreadCount, "U, ", socket.uMaxSpeed, "U, ", socket.uCurrentSpeed, "U,\n\t\t\t{\n");
+
+		for (const ProcessorCache_t& cache : socket.arrCaches)
+		{
+			if (cache.uHandle == 0xFFFF)
+			{
+				output.Append("\t\t\t\t{ false, false, 0U, 0U, \"unknown\", \"unknown\", \"unknown\" },\n");
+				continue;
+			}
+
+			output.Print("\t\t\t\t{ true, ", cache.bEnabled ? "true" : "false", ", ", cache.ullSizeKiB, "U, ", cache.nWays, "U, \"", GetCacheAssociativity(cache), "\", \"", GetCacheType(cache), "\", \"", arrCachePolicy[cache.nOperationalMode], "\" },\n");
+		}
+		output.Append("\t\t\t} },\n");
+	}
+	output.Append("\t} };\n}\n");
+}
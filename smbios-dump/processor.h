@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "decode.h"
+#include "output.h"
+
+// format of the processor summary
+enum ESummaryFormat : std::uint8_t
+{
+	// single JSON document
+	SUMMARY_FORMAT_JSON = 0,
+	// 'KEY=value' lines, that may be sourced by the shell or read as the environment file
+	SUMMARY_FORMAT_ENV,
+	// C++ header of the 'constexpr' constants
+	SUMMARY_FORMAT_HEADER
+};
+
+// cache of the single level, that the processor references
+struct ProcessorCache_t
+{
+	// cache information structure, or 0xFFFF when the processor doesn't have the cache of this level, or it's not described
+	std::uint16_t uHandle;
+	bool bEnabled;
+	// installed size, zero when it's unknown
+	std::uint64_t ullSizeKiB;
+	// zero when it's unknown, or the cache is fully associative
+	std::uint8_t nWays;
+	// raw values of the structure, zero when they're not present
+	std::uint8_t nAssociativity;
+	std::uint8_t nSystemCacheType;
+	std::uint8_t nOperationalMode;
+};
+
+// central processor socket, populated or empty
+struct ProcessorSocket_t
+{
+	std::uint16_t uHandle;
+	// strings of the processor, referencing the table, with null value when they're not specified
+	COutput::String_t designation;
+	COutput::String_t manufacturer;
+	COutput::String_t version;
+	bool bPopulated;
+	// zero when they're unknown
+	std::uint16_t nCoreCount;
+	std::uint16_t nCoreEnabled;
+	std::uint16_t nThreadCount;
+	// in MHz, zero when they're unknown
+	std::uint16_t uMaxSpeed;
+	std::uint16_t uCurrentSpeed;
+	// L1, L2 and L3 caches
+	ProcessorCache_t arrCaches[3];
+};
+
+/*
+ * summary of the central processors and their caches, to size the thread pools and the blocking factors of the host
+ * @remarks: cache handles of each processor are resolved to the cache information structures, sizes are the installed sizes the firmware reports for the whole socket.
+ * summary references the table strings, so the table must outlive it
+ */
+class CProcessorSummary
+{
+public:
+	// build the summary of the given table, replacing the previous one
+	void Build(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize);
+	// append the summary in the given format, totals count only the populated sockets
+	void Append(COutput& output, ESummaryFormat nFormat) const;
+
+	[[nodiscard]] const std::vector<ProcessorSocket_t>& GetSockets() const
+	{
+		return vecSockets;
+	}
+
+private:
+	void AppendJson(COutput& output) const;
+	void AppendEnvironment(COutput& output) const;
+	void AppendHeader(COutput& output) const;
+
+	std::vector<ProcessorSocket_t> vecSockets;
+};
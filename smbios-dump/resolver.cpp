@@ -0,0 +1,202 @@
+#include "resolver.h"
+
+#include <algorithm>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+
+// range of the physical addresses in bytes, mapped either to the device or only to the array
+struct MappedRange_t
+{
+	std::uint64_t ullBegin;
+	// exclusive, zero when the range ends at the top of the address space
+	std::uint64_t ullEnd;
+	MappedDevice_t device;
+};
+
+/*
+ * get the range of the physical addresses in bytes, that is stored in kilobytes, or in bytes by the extended fields when the kilobytes don't fit
+ * @param[in] bHasExtended whether the structure is long enough to have the extended fields
+ * @returns: true if range is valid, false otherwise
+ */
+static bool GetMappedRange(const std::uint32_t uStartingAddress, const std::uint32_t uEndingAddress, const bool bHasExtended, const std::uint64_t ullStartingAddressExtended, const std::uint64_t ullEndingAddressExtended, MappedRange_t& range)
+{
+	std::uint64_t ullLast;
+	if (uStartingAddress == ~0U)
+	{
+		if (!bHasExtended)
+			return false;
+
+		range.ullBegin = ullStartingAddressExtended;
+		ullLast = ullEndingAddressExtended;
+	}
+	else
+	{
+		range.ullBegin = static_cast<std::uint64_t>(uStartingAddress) << 10U;
+		// ending address is the last kilobyte of the range
+		ullLast = (static_cast<std::uint64_t>(uEndingAddress) << 10U) | 0x3FFULL;
+	}
+
+	range.ullEnd = ullLast + 1U;
+	return range.ullBegin <= ullLast;
+}
+
+void CAddressResolver::Build(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize)
+{
+	vecSegmentStarts.clear();
+	vecSegmentDeviceOffsets.clear();
+	vecSegmentDevices.clear();
+
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	// devices are referenced by the mapped addresses
+	CHandleIndex& handleIndex = state.handleIndex;
+	handleIndex.Reset(pTableData);
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+		handleIndex.Insert(reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]));
+
+	std::vector<MappedRange_t> vecDeviceRanges;
+	std::vector<MappedRange_t> vecArrayRanges;
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+
+		MappedRange_t range = { };
+		range.device.uDeviceHandle = 0xFFFF;
+		range.device.uArrayMappedAddressHandle = pStructure->uHandle;
+
+		if (pStructure->nType == SMBIOS::TYPE_MEMORY_ARRAY_MAPPED_ADDRESS && pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::MemoryArrayMappedAddress_t, ullStartingAddressExtended))
+		{
+			const auto pMAMA = reinterpret_cast<const SMBIOS::MemoryArrayMappedAddress_t*>(pStructure->arrData);
+			const bool bHasExtended = (pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::MemoryArrayMappedAddress_t, ullEndingAddressExtended) + sizeof(std::uint64_t));
+			if (GetMappedRange(pMAMA->uStartingAddress, pMAMA->uEndingAddress, bHasExtended, bHasExtended ? pMAMA->ullStartingAddressExtended : 0ULL, bHasExtended ? pMAMA->ullEndingAddressExtended : 0ULL, range))
+				vecArrayRanges.push_back(range);
+		}
+		else if (pStructure->nType == SMBIOS::TYPE_MEMORY_DEVICE_MAPPED_ADDRESS && pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::MemoryDeviceMappedAddress_t, ullStartingAddressExtended))
+		{
+			const auto pMDMA = reinterpret_cast<const SMBIOS::MemoryDeviceMappedAddress_t*>(pStructure->arrData);
+			const bool bHasExtended = (pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::MemoryDeviceMappedAddress_t, ullEndingAddressExtended) + sizeof(std::uint64_t));
+			if (!GetMappedRange(pMDMA->uStartingAddress, pMDMA->uEndingAddress, bHasExtended, bHasExtended ? pMDMA->ullStartingAddressExtended : 0ULL, bHasExtended ? pMDMA->ullEndingAddressExtended : 0ULL, range))
+				continue;
+
+			range.device.uDeviceHandle = pMDMA->uDeviceHandle;
+			range.device.uArrayMappedAddressHandle = pMDMA->uArrayMappedAddressHandle;
+			range.device.uInterleavePosition = pMDMA->uInterleavePosition;
+			range.device.uInterleaveDataDepth = pMDMA->uInterleaveDataDepth;
+			range.device.uPartitionRowPosition = pMDMA->uPartitionRowPosition;
+
+			// strings of the device that isn't present are left null
+			if (const SMBIOS::StructureHeader_t* pDevice = handleIndex.Find(pMDMA->uDeviceHandle); pDevice != nullptr && pDevice->nType == SMBIOS::TYPE_MEMORY_DEVICE && pDevice->nLength > SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, nBankLocator))
+			{
+				// all indexed structures are complete, so the string-set ends at the beginning of the following one
+				const auto uDeviceOffset = static_cast<std::uint32_t>(reinterpret_cast<const std::uint8_t*>(pDevice) - pTableData);
+				const std::uint8_t* pDeviceEnd = pTableData + *std::upper_bound(vecBoundaries.begin(), vecBoundaries.end(), uDeviceOffset);
+
+				const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pDevice->arrData);
+				CStringSet strings(pDevice, pDeviceEnd);
+				range.device.deviceLocator = strings.Get(pMD->nDeviceLocator);
+				range.device.bankLocator = strings.Get(pMD->nBankLocator);
+			}
+
+			vecDeviceRanges.push_back(range);
+		}
+	}
+
+	// ranges end at the beginning of the following segment, the range ending at the top of the address space has no such segment
+	std::vector<std::uint64_t>& vecPoints = vecSegmentStarts;
+	for (const std::vector<MappedRange_t>* pvecRanges : { &vecDeviceRanges, &vecArrayRanges })
+	{
+		for (const MappedRange_t& range : *pvecRanges)
+		{
+			vecPoints.push_back(range.ullBegin);
+			if (range.ullEnd != 0U)
+				vecPoints.push_back(range.ullEnd);
+		}
+	}
+
+	std::sort(vecPoints.begin(), vecPoints.end());
+	vecPoints.erase(std::unique(vecPoints.begin(), vecPoints.end()), vecPoints.end());
+
+	const auto fnContains = [](const MappedRange_t& range, const std::uint64_t ullAddress)
+	{
+		return ullAddress >= range.ullBegin && (range.ullEnd == 0U || ullAddress < range.ullEnd);
+	};
+
+	// there are a few dozens of ranges even on the large machines, so each segment simply checks all of them
+	vecSegmentDeviceOffsets.reserve(vecPoints.size() + 1U);
+	for (const std::uint64_t ullSegmentStart : vecPoints)
+	{
+		vecSegmentDeviceOffsets.push_back(static_cast<std::uint32_t>(vecSegmentDevices.size()));
+
+		for (const MappedRange_t& range : vecDeviceRanges)
+		{
+			if (fnContains(range, ullSegmentStart))
+				vecSegmentDevices.push_back(range.device);
+		}
+
+		// the array is reported only for the addresses, that no device is mapped to
+		if (vecSegmentDevices.size() != vecSegmentDeviceOffsets.back())
+			continue;
+
+		for (const MappedRange_t& range : vecArrayRanges)
+		{
+			if (fnContains(range, ullSegmentStart))
+			{
+				vecSegmentDevices.push_back(range.device);
+				break;
+			}
+		}
+	}
+	vecSegmentDeviceOffsets.push_back(static_cast<std::uint32_t>(vecSegmentDevices.size()));
+}
+
+std::uint32_t CAddressResolver::FindSegment(const std::uint64_t ullAddress) const
+{
+	const std::uint32_t nSegmentCount = GetSegmentCount();
+	if (nSegmentCount == 0U || ullAddress < vecSegmentStarts[0])
+		return nSegmentCount;
+
+	// branchless search of the last segment that starts at or before the address, so it isn't slowed down by the mispredictions of the random addresses
+	const std::uint64_t* pBase = vecSegmentStarts.data();
+	std::size_t nCount = nSegmentCount;
+	while (nCount > 1U)
+	{
+		const std::size_t nHalf = nCount / 2U;
+		pBase = (pBase[nHalf] <= ullAddress ? pBase + nHalf : pBase);
+		nCount -= nHalf;
+	}
+
+	const auto nSegmentIndex = static_cast<std::uint32_t>(pBase - vecSegmentStarts.data());
+	return vecSegmentDeviceOffsets[nSegmentIndex] != vecSegmentDeviceOffsets[nSegmentIndex + 1U] ? nSegmentIndex : nSegmentCount;
+}
+
+const MappedDevice_t* CAddressResolver::Resolve(const std::uint64_t ullAddress, std::size_t* pnDeviceCount) const
+{
+	return GetSegmentDevices(FindSegment(ullAddress), pnDeviceCount);
+}
+
+void CAddressResolver::ResolveBatch(const std::uint64_t* pAddresses, const std::size_t nAddressCount, std::uint32_t* pnSegmentIndices) const
+{
+	// searches are independent of each other, so they're overlapped by the processor
+	for (std::size_t i = 0U; i < nAddressCount; ++i)
+		pnSegmentIndices[i] = FindSegment(pAddresses[i]);
+}
+
+const MappedDevice_t* CAddressResolver::GetSegmentDevices(const std::uint32_t nSegmentIndex, std::size_t* pnDeviceCount) const
+{
+	if (nSegmentIndex >= GetSegmentCount())
+	{
+		*pnDeviceCount = 0U;
+		return nullptr;
+	}
+
+	*pnDeviceCount = vecSegmentDeviceOffsets[nSegmentIndex + 1U] - vecSegmentDeviceOffsets[nSegmentIndex];
+	return vecSegmentDevices.data() + vecSegmentDeviceOffsets[nSegmentIndex];
+}
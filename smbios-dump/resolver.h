@@ -0,0 +1,93 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "decode.h"
+#include "output.h"
+
+// memory device, that the range of physical addresses is mapped to by the memory device mapped address structure
+struct MappedDevice_t
+{
+	// memory device structure, or 0xFFFF when the range is mapped only to the memory array
+	std::uint16_t uDeviceHandle;
+	// memory array mapped address structure, that contains the range
+	std::uint16_t uArrayMappedAddressHandle;
+	// strings of the memory device, referencing the table, with null value when they're not specified
+	COutput::String_t deviceLocator;
+	COutput::String_t bankLocator;
+	// 0 when the device isn't interleaved, 0xFF when it's unknown
+	std::uint8_t uInterleavePosition;
+	std::uint8_t uInterleaveDataDepth;
+	std::uint8_t uPartitionRowPosition;
+};
+
+/*
+ * resolver of the physical addresses to the memory devices, that is built from the memory array mapped address, memory device mapped address and memory device structures
+ * @remarks: mapped ranges may overlap, e.g. the devices of the same interleave set share the range, so they're split into the disjoint segments, each with the list of devices mapping it, that is empty for the gaps between the ranges.
+ * address is then resolved by the binary search of its segment. resolver references the table strings, so the table must outlive it. resolver isn't changed once it's built, so it may be used by several threads at once
+ */
+class CAddressResolver
+{
+public:
+	// build the index of the given table, replacing the previous one
+	void Build(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize);
+
+	/*
+	 * resolve the physical address in bytes
+	 * @param[out] pnDeviceCount count of the devices, that the address may belong to, it's more than one for the interleaved devices
+	 * @returns: devices, that the address may belong to, null if address isn't mapped
+	 */
+	[[nodiscard]] const MappedDevice_t* Resolve(std::uint64_t ullAddress, std::size_t* pnDeviceCount) const;
+
+	/*
+	 * resolve the physical addresses in bytes at once
+	 * @param[out] pnSegmentIndices index of the segment of each address, or 'GetSegmentCount()' if address isn't mapped, its devices are got by 'GetSegmentDevices'
+	 */
+	void ResolveBatch(const std::uint64_t* pAddresses, std::size_t nAddressCount, std::uint32_t* pnSegmentIndices) const;
+
+	// @returns: devices mapping the given segment, null if it's not mapped
+	[[nodiscard]] const MappedDevice_t* GetSegmentDevices(std::uint32_t nSegmentIndex, std::size_t* pnDeviceCount) const;
+
+	/*
+	 * report each mapped segment overlapping the given range of physical addresses to the callback, in ascending order
+	 * @param[in] ullEnd exclusive end of the range
+	 * @param[in] fnVisit callback of 'void(const MappedDevice_t* pDevices, std::size_t nDeviceCount, std::uint64_t ullOverlapSize)'
+	 */
+	template <typename F>
+	void ForEachSegment(const std::uint64_t ullBegin, const std::uint64_t ullEnd, F&& fnVisit) const
+	{
+		const std::uint32_t nSegmentCount = GetSegmentCount();
+		auto itSegment = std::upper_bound(vecSegmentStarts.begin(), vecSegmentStarts.end(), ullBegin);
+		std::uint32_t nSegmentIndex = (itSegment == vecSegmentStarts.begin() ? 0U : static_cast<std::uint32_t>(itSegment - vecSegmentStarts.begin()) - 1U);
+		for (; nSegmentIndex < nSegmentCount && vecSegmentStarts[nSegmentIndex] < ullEnd; ++nSegmentIndex)
+		{
+			// the last segment runs to the top of the address space
+			const std::uint64_t ullOverlapBegin = std::max(ullBegin, vecSegmentStarts[nSegmentIndex]);
+			const std::uint64_t ullOverlapEnd = (nSegmentIndex + 1U < nSegmentCount ? std::min(ullEnd, vecSegmentStarts[nSegmentIndex + 1U]) : ullEnd);
+			if (ullOverlapBegin >= ullOverlapEnd)
+				continue;
+
+			std::size_t nDeviceCount = 0U;
+			const MappedDevice_t* pDevices = GetSegmentDevices(nSegmentIndex, &nDeviceCount);
+			if (nDeviceCount > 0U)
+				fnVisit(pDevices, nDeviceCount, ullOverlapEnd - ullOverlapBegin);
+		}
+	}
+
+	[[nodiscard]] std::uint32_t GetSegmentCount() const
+	{
+		return static_cast<std::uint32_t>(vecSegmentStarts.size());
+	}
+
+private:
+	// @returns: index of the segment containing the address, 'GetSegmentCount()' if it's not mapped
+	[[nodiscard]] std::uint32_t FindSegment(std::uint64_t ullAddress) const;
+
+	// starting address of each segment in ascending order, segment ends where the next one starts, and the last one at the top of the address space
+	std::vector<std::uint64_t> vecSegmentStarts;
+	// index of the first device of each segment in the devices list, followed by the count of all devices
+	std::vector<std::uint32_t> vecSegmentDeviceOffsets;
+	std::vector<MappedDevice_t> vecSegmentDevices;
+};
@@ -0,0 +1,181 @@
+#include "scanner.h"
+
+#include <bit>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define SCANNER_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+// msvc allows to use any intrinsics without enabling them for the whole translation unit
+#define SCANNER_TARGET(FEATURES)
+#else
+#define SCANNER_TARGET(FEATURES) __attribute__((target(FEATURES)))
+#endif
+#endif
+
+/*
+ * search for the terminator of the string set, that is the first pair of null characters
+ * @returns: pointer to the terminator, null if it isn't present before the end
+ */
+static const std::uint8_t* FindTerminatorScalar(const std::uint8_t* pCurrent, const std::uint8_t* pEnd)
+{
+	for (; pEnd - pCurrent >= 2; ++pCurrent)
+	{
+		if (pCurrent[0] == '\0' && pCurrent[1] == '\0')
+			return pCurrent;
+	}
+
+	return nullptr;
+}
+
+#ifdef SCANNER_X86
+// compare each byte and its successor against zero at once, the remainder shorter than a vector is searched by bytes
+SCANNER_TARGET("sse2") static const std::uint8_t* FindTerminatorSSE2(const std::uint8_t* pCurrent, const std::uint8_t* pEnd)
+{
+	const __m128i vecZero = _mm_setzero_si128();
+	for (; pEnd - pCurrent > 16; pCurrent += 16)
+	{
+		const __m128i vecBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurrent));
+		const __m128i vecNextBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurrent + 1));
+		const std::uint32_t uMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(vecBytes, vecZero), _mm_cmpeq_epi8(vecNextBytes, vecZero))));
+		if (uMask != 0U)
+			return pCurrent + std::countr_zero(uMask);
+	}
+
+	return FindTerminatorScalar(pCurrent, pEnd);
+}
+
+SCANNER_TARGET("avx2") static const std::uint8_t* FindTerminatorAVX2(const std::uint8_t* pCurrent, const std::uint8_t* pEnd)
+{
+	const __m256i vecZero = _mm256_setzero_si256();
+	for (; pEnd - pCurrent > 32; pCurrent += 32)
+	{
+		const __m256i vecBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pCurrent));
+		const __m256i vecNextBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pCurrent + 1));
+		const std::uint32_t uMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(vecBytes, vecZero), _mm256_cmpeq_epi8(vecNextBytes, vecZero))));
+		if (uMask != 0U)
+			return pCurrent + std::countr_zero(uMask);
+	}
+
+	return FindTerminatorSSE2(pCurrent, pEnd);
+}
+
+SCANNER_TARGET("avx512f,avx512bw") static const std::uint8_t* FindTerminatorAVX512(const std::uint8_t* pCurrent, const std::uint8_t* pEnd)
+{
+	const __m512i vecZero = _mm512_setzero_si512();
+	for (; pEnd - pCurrent > 64; pCurrent += 64)
+	{
+		const __m512i vecBytes = _mm512_loadu_si512(pCurrent);
+		const __m512i vecNextBytes = _mm512_loadu_si512(pCurrent + 1);
+		const std::uint64_t ullMask = _mm512_cmpeq_epi8_mask(vecBytes, vecZero) & _mm512_cmpeq_epi8_mask(vecNextBytes, vecZero);
+		if (ullMask != 0ULL)
+			return pCurrent + std::countr_zero(ullMask);
+	}
+
+	return FindTerminatorAVX2(pCurrent, pEnd);
+}
+#endif
+
+EScanLevel GetSupportedScanLevel()
+{
+#ifdef SCANNER_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+	int arrRegisters[4] = { };
+	__cpuid(arrRegisters, 0);
+	const int nMaxLeaf = arrRegisters[0];
+
+	__cpuid(arrRegisters, 1);
+	if ((arrRegisters[3] & (1 << 26)) == 0)
+		return SCAN_LEVEL_SCALAR;
+
+	// wider registers must be enabled by the operating system as well
+	if ((arrRegisters[2] & (1 << 27)) == 0 || nMaxLeaf < 7)
+		return SCAN_LEVEL_SSE2;
+
+	const unsigned long long ullEnabledFeatures = _xgetbv(0);
+	__cpuidex(arrRegisters, 7, 0);
+	if ((ullEnabledFeatures & 0xE6) == 0xE6 && (arrRegisters[1] & (1 << 16)) != 0 && (arrRegisters[1] & (1 << 30)) != 0)
+		return SCAN_LEVEL_AVX512;
+	if ((ullEnabledFeatures & 0x6) == 0x6 && (arrRegisters[1] & (1 << 5)) != 0)
+		return SCAN_LEVEL_AVX2;
+
+	return SCAN_LEVEL_SSE2;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		return SCAN_LEVEL_AVX512;
+	if (__builtin_cpu_supports("avx2"))
+		return SCAN_LEVEL_AVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return SCAN_LEVEL_SSE2;
+
+	return SCAN_LEVEL_SCALAR;
+#endif
+#else
+	return SCAN_LEVEL_SCALAR;
+#endif
+}
+
+const char* GetScanLevelName(const EScanLevel nLevel)
+{
+	constexpr const char* arrLevelName[SCAN_LEVEL_COUNT] =
+	{
+		"scalar",
+		"sse2",
+		"avx2",
+		"avx512"
+	};
+
+	return nLevel < SCAN_LEVEL_COUNT ? arrLevelName[nLevel] : "unknown";
+}
+
+template <const std::uint8_t* (*FindTerminator)(const std::uint8_t*, const std::uint8_t*)>
+static bool WalkStructures(const std::uint8_t* pTableData, const std::size_t nTableSize, std::vector<std::uint32_t>& vecBoundaries)
+{
+	const std::uint8_t* pTableEnd = pTableData + nTableSize;
+	const std::uint8_t* pStructureData = pTableData;
+
+	vecBoundaries.clear();
+	while (true)
+	{
+		vecBoundaries.push_back(static_cast<std::uint32_t>(pStructureData - pTableData));
+
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pStructureData);
+		if (static_cast<std::size_t>(pTableEnd - pStructureData) < sizeof(SMBIOS::StructureHeader_t) || static_cast<std::size_t>(pTableEnd - pStructureData) < pStructure->nLength)
+			return false;
+
+		// the string set begins right after the formatted area, and ends with the pair of null characters, even if it's empty
+		const std::uint8_t* pTerminator = FindTerminator(pStructureData + pStructure->nLength, pTableEnd);
+		if (pTerminator == nullptr)
+			return false;
+
+		pStructureData = pTerminator + 2;
+
+		if (pStructure->nType == SMBIOS::TYPE_END_OF_TABLE)
+		{
+			vecBoundaries.push_back(static_cast<std::uint32_t>(pStructureData - pTableData));
+			return true;
+		}
+	}
+}
+
+bool FindStructureBoundaries(const std::uint8_t* pTableData, const std::size_t nTableSize, std::vector<std::uint32_t>& vecBoundaries, const EScanLevel nLevel)
+{
+	switch (nLevel)
+	{
+#ifdef SCANNER_X86
+	case SCAN_LEVEL_SSE2:
+		return WalkStructures<&FindTerminatorSSE2>(pTableData, nTableSize, vecBoundaries);
+	case SCAN_LEVEL_AVX2:
+		return WalkStructures<&FindTerminatorAVX2>(pTableData, nTableSize, vecBoundaries);
+	case SCAN_LEVEL_AVX512:
+		return WalkStructures<&FindTerminatorAVX512>(pTableData, nTableSize, vecBoundaries);
+#endif
+	default:
+		return WalkStructures<&FindTerminatorScalar>(pTableData, nTableSize, vecBoundaries);
+	}
+}
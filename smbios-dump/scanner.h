@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// instruction set used to search for the string set terminators, in order of preference
+enum EScanLevel : std::uint8_t
+{
+	SCAN_LEVEL_SCALAR = 0,
+	SCAN_LEVEL_SSE2,
+	SCAN_LEVEL_AVX2,
+	SCAN_LEVEL_AVX512,
+	SCAN_LEVEL_COUNT
+};
+
+// @returns: the best instruction set supported by both the build and the current processor
+[[nodiscard]] EScanLevel GetSupportedScanLevel();
+[[nodiscard]] const char* GetScanLevelName(EScanLevel nLevel);
+
+/*
+ * find the boundaries of all structures of the table, walking up to and including the end of table structure
+ * each boundary is the offset of the structure beginning, followed by the offset right past the last structure, so the structure 'i' spans from 'vecBoundaries[i]' to 'vecBoundaries[i + 1]'
+ * @param[in] nLevel instruction set to use, must be supported by the current processor
+ * @returns: true if the walk reached the end of table structure, false if the structure at the last boundary exceeds the table boundary
+ */
+bool FindStructureBoundaries(const std::uint8_t* pTableData, std::size_t nTableSize, std::vector<std::uint32_t>& vecBoundaries, EScanLevel nLevel);
+
+// find the boundaries with the best supported instruction set
+inline bool FindStructureBoundaries(const std::uint8_t* pTableData, const std::size_t nTableSize, std::vector<std::uint32_t>& vecBoundaries)
+{
+	static const EScanLevel nSupportedLevel = GetSupportedScanLevel();
+	return FindStructureBoundaries(pTableData, nTableSize, vecBoundaries, nSupportedLevel);
+}
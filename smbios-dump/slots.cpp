@@ -0,0 +1,280 @@
+#include "slots.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "emitter.h"
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+
+constexpr const char* arrCurrentUsage[] =
+{
+	"other",
+	"unknown",
+	"available",
+	"in_use",
+	"unavailable"
+};
+
+// @returns: designated PCIe generation of the slot type, zero when it's not PCIe or doesn't tell it
+static std::uint8_t GetSlotTypeGeneration(const std::uint8_t nSlotType)
+{
+	using namespace SMBIOS;
+	// each generation is followed by its x1, x2, x4, x8 and x16 variants
+	if (nSlotType >= SLOT_PCIE && nSlotType <= SLOT_PCIE5_X16)
+		return static_cast<std::uint8_t>((nSlotType - SLOT_PCIE) / 6U + 1U);
+
+	switch (nSlotType)
+	{
+	case SLOT_PCIE6:
+		return 6U;
+	case SLOT_PCIE2_U2:
+		return 2U;
+	case SLOT_PCIE3_U2:
+		return 3U;
+	case SLOT_PCIE4_U2:
+		return 4U;
+	case SLOT_PCIE5_U2:
+		return 5U;
+	default:
+		return 0U;
+	}
+}
+
+// @returns: designated lanes of the slot, zero when they're unknown
+static std::uint8_t GetSlotWidth(const std::uint8_t nSlotType, const std::uint8_t nSlotDataBusWidth)
+{
+	// data bus width is given from 'x1' to 'x32' by the later values
+	constexpr std::uint8_t arrDataBusLanes[] = { 1U, 2U, 4U, 8U, 12U, 16U, 32U };
+	if (nSlotDataBusWidth >= 0x08 && nSlotDataBusWidth < 0x08 + Q_ARRAYSIZE(arrDataBusLanes))
+		return arrDataBusLanes[nSlotDataBusWidth - 0x08];
+
+	// otherwise it may be told by the slot type, that is unsized for the first of each generation
+	using namespace SMBIOS;
+	if (nSlotType >= SLOT_PCIE && nSlotType <= SLOT_PCIE5_X16 && (nSlotType - SLOT_PCIE) % 6U != 0U)
+		return static_cast<std::uint8_t>(1U << ((nSlotType - SLOT_PCIE) % 6U - 1U));
+
+	return 0U;
+}
+
+// append the address as it's written by the system, e.g. "0000:3b:00.0"
+static void AppendPciAddress(COutput& output, const std::uint32_t uAddress)
+{
+	char szAddress[16];
+	std::snprintf(szAddress, sizeof(szAddress), "%04x:%02x:%02x.%x", uAddress >> 16U, (uAddress >> 8U) & 0xFF, (uAddress >> 3U) & 0x1F, uAddress & 0x7);
+	output.Print('"', szAddress, '"');
+}
+
+// @returns: kind of the function by its class code, to tell the cards that usually matter at a glance
+static const char* GetDeviceKind(const std::uint32_t uClass)
+{
+	if (uClass == 0x010802)
+		return "nvme";
+	if ((uClass >> 16U) == 0x02)
+		return "network";
+	if ((uClass >> 16U) == 0x03)
+		return "display";
+	if ((uClass >> 16U) == 0x12)
+		return "accelerator";
+	if ((uClass >> 8U) == 0x0604)
+		return "bridge";
+
+	return "other";
+}
+
+void CPcieSlotMap::Build(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize)
+{
+	vecSlots.clear();
+	vecAddressIndex.clear();
+	vecDevices.clear();
+	nUnassignedCount = 0U;
+
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+
+	for (std::size_t i = 0U; i + 1U < vecBoundaries.size(); ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType != SMBIOS::TYPE_SYSTEM_SLOTS || pStructure->nLength < SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, uSlotID))
+			continue;
+
+		const auto pSS = reinterpret_cast<const SMBIOS::SystemSlots_t*>(pStructure->arrData);
+		CStringSet strings(pStructure, pTableData + vecBoundaries[i + 1U]);
+
+		PcieSlot_t slot = { };
+		slot.uHandle = pStructure->uHandle;
+		slot.designation = strings.Get(pSS->nSlotDesignation);
+		slot.nSlotType = pSS->nSlotType;
+		slot.nCurrentUsage = pSS->nCurrentUsage;
+		slot.nWidth = GetSlotWidth(pSS->nSlotType, pSS->nSlotDataBusWidth);
+		slot.nGeneration = GetSlotTypeGeneration(pSS->nSlotType);
+
+		// address is present since 2.6, and is all ones when the slot doesn't have it
+		if (pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::SystemSlots_t, nDataBusWidth) && !(pSS->nSegmentGroupNumber == 0xFFFF && pSS->nBusNumber == 0xFF))
+		{
+			slot.bHasAddress = true;
+			slot.uAddress = MakePciAddress(pSS->nSegmentGroupNumber, pSS->nBusNumber, pSS->uDeviceNumber, pSS->uFunctionNumber);
+			vecAddressIndex.emplace_back(slot.uAddress, static_cast<std::uint32_t>(vecSlots.size()));
+		}
+
+		vecSlots.push_back(slot);
+	}
+
+	// the first slot is kept when several of them claim the same address
+	std::stable_sort(vecAddressIndex.begin(), vecAddressIndex.end(), [](const auto& first, const auto& second)
+	{
+		return first.first < second.first;
+	});
+}
+
+std::size_t CPcieSlotMap::FindSlot(const std::uint32_t uAddress) const
+{
+	const auto itAddress = std::lower_bound(vecAddressIndex.begin(), vecAddressIndex.end(), uAddress, [](const std::pair<std::uint32_t, std::uint32_t>& entry, const std::uint32_t uValue)
+	{
+		return entry.first < uValue;
+	});
+
+	return (itAddress != vecAddressIndex.end() && itAddress->first == uAddress) ? itAddress->second : vecSlots.size();
+}
+
+std::size_t CPcieSlotMap::JoinDevices(const std::vector<PciDevice_t>& vecPciDevices)
+{
+	vecDevices = vecPciDevices;
+	std::sort(vecDevices.begin(), vecDevices.end(), [](const PciDevice_t& first, const PciDevice_t& second)
+	{
+		return first.uAddress < second.uAddress;
+	});
+
+	for (PcieSlot_t& slot : vecSlots)
+		slot.vecDeviceIndices.clear();
+
+	nUnassignedCount = 0U;
+	for (std::uint32_t i = 0U; i < vecDevices.size(); ++i)
+	{
+		const PciDevice_t& device = vecDevices[i];
+		const bool bBridge = ((device.uClass >> 8U) == 0x0604);
+
+		// root port of the slot is the bridge itself, so only the functions below it are in the slot, while the other functions of the card are given by its first one
+		std::size_t nSlotIndex = vecSlots.size();
+		if (!bBridge && (nSlotIndex = FindSlot(device.uAddress)) == vecSlots.size())
+			nSlotIndex = FindSlot(device.uAddress & ~0x7U);
+		if (nSlotIndex == vecSlots.size() && device.uParentAddress != ~0U)
+			nSlotIndex = FindSlot(device.uParentAddress);
+
+		if (nSlotIndex == vecSlots.size())
+		{
+			++nUnassignedCount;
+			continue;
+		}
+
+		vecSlots[nSlotIndex].vecDeviceIndices.push_back(i);
+	}
+
+	return nUnassignedCount;
+}
+
+// append the finding of the link, that is narrower or slower than expected, unless it's not
+static void AppendLinkFinding(COutput& output, bool& bFirstFinding, const char* szKind, const PcieSlot_t& slot, const PciDevice_t& device, const std::uint8_t nExpected, const std::uint8_t nActual)
+{
+	if (nExpected == 0U || nActual == 0U || nActual >= nExpected)
+		return;
+
+	output.Print(bFirstFinding ? "" : ",", "{\"kind\":\"", szKind, "\",\"slot\":");
+	CEmitter::AppendString(output, slot.designation);
+	output.Print(",\"handle\":", slot.uHandle, ",\"address\":");
+	AppendPciAddress(output, device.uAddress);
+	output.Print(",\"device_kind\":\"", GetDeviceKind(device.uClass), "\",\"expected\":", nExpected, ",\"actual\":", nActual, '}');
+	bFirstFinding = false;
+}
+
+// append the value, or null when it's unknown
+static void AppendKnown(COutput& output, const std::uint8_t nValue)
+{
+	if (nValue == 0U)
+		output.Append("null");
+	else
+		output.Append(nValue);
+}
+
+void CPcieSlotMap::AppendReport(COutput& output) const
+{
+	std::size_t nOccupiedCount = 0U;
+	for (const PcieSlot_t& slot : vecSlots)
+		nOccupiedCount += !slot.vecDeviceIndices.empty();
+
+	output.Print("{\"slots\":", vecSlots.size(), ",\"occupied_slots\":", nOccupiedCount, ",\"devices\":", vecDevices.size(), ",\"unassigned_devices\":", nUnassignedCount, ",\"map\":[");
+	for (std::size_t i = 0U; i < vecSlots.size(); ++i)
+	{
+		const PcieSlot_t& slot = vecSlots[i];
+		output.Print(i > 0U ? ",{\"handle\":" : "{\"handle\":", slot.uHandle, ",\"designation\":");
+		CEmitter::AppendString(output, slot.designation);
+		output.Print(",\"type\":", slot.nSlotType, ",\"usage\":");
+		if (slot.nCurrentUsage >= 1U && slot.nCurrentUsage <= Q_ARRAYSIZE(arrCurrentUsage))
+			output.Print('"', arrCurrentUsage[slot.nCurrentUsage - 1U], '"');
+		else
+			output.Append("null");
+
+		output.Append(",\"address\":");
+		if (slot.bHasAddress)
+			AppendPciAddress(output, slot.uAddress);
+		else
+			output.Append("null");
+
+		output.Append(",\"width\":");
+		AppendKnown(output, slot.nWidth);
+		output.Append(",\"generation\":");
+		AppendKnown(output, slot.nGeneration);
+		output.Append(",\"devices\":[");
+
+		for (std::size_t j = 0U; j < slot.vecDeviceIndices.size(); ++j)
+		{
+			const PciDevice_t& device = vecDevices[slot.vecDeviceIndices[j]];
+			output.Append(j > 0U ? ",{\"address\":" : "{\"address\":");
+			AppendPciAddress(output, device.uAddress);
+			output.Print(",\"class\":\"0x", COutput::Hex(device.uClass, 6), "\",\"kind\":\"", GetDeviceKind(device.uClass), "\",\"current_width\":");
+			AppendKnown(output, device.nCurrentLinkWidth);
+			output.Append(",\"max_width\":");
+			AppendKnown(output, device.nMaxLinkWidth);
+			output.Append(",\"current_generation\":");
+			AppendKnown(output, device.nCurrentLinkGeneration);
+			output.Append(",\"max_generation\":");
+			AppendKnown(output, device.nMaxLinkGeneration);
+			output.Append('}');
+		}
+		output.Append("]}");
+	}
+	output.Append("],\"findings\":[");
+
+	bool bFirstFinding = true;
+	for (const PcieSlot_t& slot : vecSlots)
+	{
+		// functions of the same card share the link, so it's checked only once for each of them
+		std::uint32_t uLastDeviceAddress = ~0U;
+		for (const std::uint32_t nDeviceIndex : slot.vecDeviceIndices)
+		{
+			const PciDevice_t& device = vecDevices[nDeviceIndex];
+			if ((device.uAddress & ~0x7U) == uLastDeviceAddress)
+				continue;
+
+			uLastDeviceAddress = device.uAddress & ~0x7U;
+
+			// card capable of more than the slot is designated for, e.g. x16 network adapter in x8 slot
+			AppendLinkFinding(output, bFirstFinding, "slot_width_limited", slot, device, device.nMaxLinkWidth, slot.nWidth);
+			AppendLinkFinding(output, bFirstFinding, "slot_generation_limited", slot, device, device.nMaxLinkGeneration, slot.nGeneration);
+
+			// link negotiated below what both the card and the slot are capable of, e.g. by the bad riser or the firmware setting
+			const std::uint8_t nExpectedWidth = (slot.nWidth != 0U ? std::min(slot.nWidth, device.nMaxLinkWidth) : device.nMaxLinkWidth);
+			const std::uint8_t nExpectedGeneration = (slot.nGeneration != 0U ? std::min(slot.nGeneration, device.nMaxLinkGeneration) : device.nMaxLinkGeneration);
+			AppendLinkFinding(output, bFirstFinding, "link_width_degraded", slot, device, nExpectedWidth, device.nCurrentLinkWidth);
+			AppendLinkFinding(output, bFirstFinding, "link_speed_degraded", slot, device, nExpectedGeneration, device.nCurrentLinkGeneration);
+		}
+	}
+
+	output.Print("],\"degraded\":", bFirstFinding ? "false" : "true", "}\n");
+}
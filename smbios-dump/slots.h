@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "decode.h"
+#include "output.h"
+
+// address of the PCI function packed as the segment, bus, device and function numbers, that are ordered the same way as they're written, e.g. '0000:3b:00.0'
+constexpr std::uint32_t MakePciAddress(const std::uint16_t uSegment, const std::uint8_t nBus, const std::uint8_t nDevice, const std::uint8_t nFunction)
+{
+	return (static_cast<std::uint32_t>(uSegment) << 16U) | (static_cast<std::uint32_t>(nBus) << 8U) | (static_cast<std::uint32_t>(nDevice & 0x1F) << 3U) | (nFunction & 0x7);
+}
+
+// PCI function, as listed in '/sys/bus/pci/devices/<segment>:<bus>:<device>.<function>'
+struct PciDevice_t
+{
+	std::uint32_t uAddress;
+	// address of the bridge, that the function is connected to, ~0 when it's connected to the root complex directly
+	std::uint32_t uParentAddress;
+	// class code, e.g. 0x020000 of the ethernet controller, zero when it's unknown
+	std::uint32_t uClass;
+	// negotiated and maximal link of the function, zero when they're unknown, e.g. of the conventional PCI function
+	std::uint8_t nCurrentLinkWidth;
+	std::uint8_t nMaxLinkWidth;
+	std::uint8_t nCurrentLinkGeneration;
+	std::uint8_t nMaxLinkGeneration;
+};
+
+// system slot, that may have the PCI address assigned
+struct PcieSlot_t
+{
+	std::uint16_t uHandle;
+	// string of the slot, referencing the table, with null value when it's not specified
+	COutput::String_t designation;
+	std::uint8_t nSlotType;
+	std::uint8_t nCurrentUsage;
+	// designated lanes and PCIe generation of the slot, zero when they're unknown
+	std::uint8_t nWidth;
+	std::uint8_t nGeneration;
+	bool bHasAddress;
+	std::uint32_t uAddress;
+	// functions in the slot, as indices of the joined devices
+	std::vector<std::uint32_t> vecDeviceIndices;
+};
+
+/*
+ * map of the PCI addresses to the system slots, that is joined with the PCI functions of the system to find the cards negotiating the narrower or slower link than they and their slot are capable of
+ * @remarks: firmware gives either the address of the card itself or of the root port above it, so the function is in the slot when the slot has its address, or the address of the same device when the function isn't the bridge, or the address of the bridge it's connected to.
+ * functions behind the switches of the card aren't listed, as their links don't leave the card. map references the table strings, so the table must outlive it
+ */
+class CPcieSlotMap
+{
+public:
+	// build the map of the given table, replacing the previous one
+	void Build(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize);
+	/*
+	 * assign the PCI functions to the slots by their addresses
+	 * @remarks: must be called after 'Build', the functions are copied
+	 * @returns: count of the functions, that haven't been assigned to any slot, e.g. the onboard devices
+	 */
+	std::size_t JoinDevices(const std::vector<PciDevice_t>& vecPciDevices);
+	// append the JSON document of the slots with their designated and negotiated links, and the findings of the limited or degraded links
+	void AppendReport(COutput& output) const;
+
+	[[nodiscard]] const std::vector<PcieSlot_t>& GetSlots() const
+	{
+		return vecSlots;
+	}
+
+private:
+	// @returns: index of the slot with the given address, 'vecSlots.size()' if there's none
+	[[nodiscard]] std::size_t FindSlot(std::uint32_t uAddress) const;
+
+	std::vector<PcieSlot_t> vecSlots;
+	// address and index of each slot that has it, in ascending order of the addresses
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> vecAddressIndex;
+	std::vector<PciDevice_t> vecDevices;
+	std::size_t nUnassignedCount = 0U;
+};
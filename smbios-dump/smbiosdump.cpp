@@ -0,0 +1,231 @@
+#include "smbiosdump.h"
+
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "decode.h"
+#include "field.h"
+#include "input.h"
+#include "scanner.h"
+#include "stringset.h"
+
+// value kinds are passed through as they are, so each of them must match
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_NULL) == static_cast<int>(VALUE_KIND_NULL), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_STRING) == static_cast<int>(VALUE_KIND_STRING), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_UNSIGNED) == static_cast<int>(VALUE_KIND_UNSIGNED), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_SIGNED) == static_cast<int>(VALUE_KIND_SIGNED), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_REAL) == static_cast<int>(VALUE_KIND_REAL), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_BOOLEAN) == static_cast<int>(VALUE_KIND_BOOLEAN), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_ENUM) == static_cast<int>(VALUE_KIND_ENUM), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_HANDLE) == static_cast<int>(VALUE_KIND_HANDLE), "value kinds of the C interface must match 'EValueKind'");
+static_assert(static_cast<int>(SMBIOSDUMP_VALUE_BYTES) == static_cast<int>(VALUE_KIND_BYTES), "value kinds of the C interface must match 'EValueKind'");
+
+struct smbiosdump_table
+{
+	// owns the mapped file or the tables of the current machine, unused for the caller buffer
+	CTableReader tableReader;
+	DecodeState_t decodeState;
+	const std::uint8_t* pTableData = nullptr;
+	std::uint32_t uVersion = 0U;
+	// offsets of the structures, followed by the offset past the last complete one
+	std::vector<std::uint32_t> vecBoundaries;
+};
+
+// locate the table in the dump and find its structures
+static std::int32_t OpenDump(smbiosdump_table* pTable, const std::uint8_t* pDumpData, const std::size_t nDumpSize)
+{
+	// errors are returned as the codes instead
+	IStructureVisitor visitorNone;
+	CEmitter emitter(pTable->decodeState.outputScratch, visitorNone);
+
+	std::size_t nTableSize = 0U;
+	if (!LocateDumpTable(emitter, pDumpData, nDumpSize, &pTable->pTableData, &nTableSize, &pTable->uVersion))
+		return SMBIOSDUMP_ERROR_FORMAT;
+
+	FindStructureBoundaries(pTable->pTableData, nTableSize, pTable->vecBoundaries);
+	return SMBIOSDUMP_OK;
+}
+
+// @returns: structure of the table at the given index, null if it's out of range
+static const SMBIOS::StructureHeader_t* GetStructure(const smbiosdump_table* pTable, const std::size_t nIndex)
+{
+	if (pTable == nullptr || nIndex + 1U >= pTable->vecBoundaries.size())
+		return nullptr;
+
+	return reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTable->pTableData + pTable->vecBoundaries[nIndex]);
+}
+
+extern "C"
+{
+	SMBIOSDUMP_API std::uint32_t smbiosdump_abi_version()
+	{
+		return SMBIOSDUMP_ABI_VERSION;
+	}
+
+	SMBIOSDUMP_API std::int32_t smbiosdump_open_buffer(const void* pDump, const std::size_t nDumpSize, smbiosdump_table** ppTable)
+	{
+		if (pDump == nullptr || ppTable == nullptr)
+			return SMBIOSDUMP_ERROR_ARGUMENT;
+
+		auto pTable = new (std::nothrow) smbiosdump_table;
+		if (pTable == nullptr)
+			return SMBIOSDUMP_ERROR_MEMORY;
+
+		if (const std::int32_t iResult = OpenDump(pTable, static_cast<const std::uint8_t*>(pDump), nDumpSize); iResult != SMBIOSDUMP_OK)
+		{
+			delete pTable;
+			return iResult;
+		}
+
+		*ppTable = pTable;
+		return SMBIOSDUMP_OK;
+	}
+
+	SMBIOSDUMP_API std::int32_t smbiosdump_open_file(const char* szPath, smbiosdump_table** ppTable)
+	{
+		if (szPath == nullptr || ppTable == nullptr)
+			return SMBIOSDUMP_ERROR_ARGUMENT;
+
+		auto pTable = new (std::nothrow) smbiosdump_table;
+		if (pTable == nullptr)
+			return SMBIOSDUMP_ERROR_MEMORY;
+
+		const std::uint8_t* pDumpData = nullptr;
+		std::size_t nDumpSize = 0U;
+		if (!pTable->tableReader.MapFile(nullptr, szPath, &pDumpData, &nDumpSize))
+		{
+			delete pTable;
+			return SMBIOSDUMP_ERROR_INPUT;
+		}
+
+		if (const std::int32_t iResult = OpenDump(pTable, pDumpData, nDumpSize); iResult != SMBIOSDUMP_OK)
+		{
+			delete pTable;
+			return iResult;
+		}
+
+		*ppTable = pTable;
+		return SMBIOSDUMP_OK;
+	}
+
+	SMBIOSDUMP_API std::int32_t smbiosdump_open_live(smbiosdump_table** ppTable)
+	{
+		if (ppTable == nullptr)
+			return SMBIOSDUMP_ERROR_ARGUMENT;
+
+		auto pTable = new (std::nothrow) smbiosdump_table;
+		if (pTable == nullptr)
+			return SMBIOSDUMP_ERROR_MEMORY;
+
+		TableView_t tableView;
+		if (!pTable->tableReader.ReadLive(nullptr, &tableView))
+		{
+			delete pTable;
+			return SMBIOSDUMP_ERROR_INPUT;
+		}
+
+		pTable->uVersion = tableView.uVersion;
+		if (tableView.pEntryPoint != nullptr)
+		{
+			IStructureVisitor visitorNone;
+			CEmitter emitter(pTable->decodeState.outputScratch, visitorNone);
+
+			std::uint32_t nLength = 0U;
+			std::uint64_t ullAddress = 0ULL;
+			if (!ParseEntryPoint(emitter, tableView.pEntryPoint, tableView.nEntryPointSize, &pTable->uVersion, &nLength, &ullAddress))
+			{
+				delete pTable;
+				return SMBIOSDUMP_ERROR_FORMAT;
+			}
+		}
+
+		pTable->pTableData = tableView.pTable;
+		FindStructureBoundaries(tableView.pTable, tableView.nTableSize, pTable->vecBoundaries);
+
+		*ppTable = pTable;
+		return SMBIOSDUMP_OK;
+	}
+
+	SMBIOSDUMP_API void smbiosdump_close(smbiosdump_table* pTable)
+	{
+		delete pTable;
+	}
+
+	SMBIOSDUMP_API std::uint32_t smbiosdump_table_version(const smbiosdump_table* pTable)
+	{
+		return pTable != nullptr ? pTable->uVersion : 0U;
+	}
+
+	SMBIOSDUMP_API std::size_t smbiosdump_structure_count(const smbiosdump_table* pTable)
+	{
+		return pTable != nullptr ? pTable->vecBoundaries.size() - 1U : 0U;
+	}
+
+	SMBIOSDUMP_API std::int32_t smbiosdump_get_structure(const smbiosdump_table* pTable, const std::size_t nIndex, smbiosdump_structure* pStructureView)
+	{
+		const SMBIOS::StructureHeader_t* pStructure = GetStructure(pTable, nIndex);
+		if (pStructure == nullptr || pStructureView == nullptr)
+			return SMBIOSDUMP_ERROR_ARGUMENT;
+
+		pStructureView->type = pStructure->nType;
+		pStructureView->length = pStructure->nLength;
+		pStructureView->handle = pStructure->uHandle;
+		pStructureView->data = reinterpret_cast<const std::uint8_t*>(pStructure);
+		pStructureView->size = pTable->vecBoundaries[nIndex + 1U] - pTable->vecBoundaries[nIndex];
+		return SMBIOSDUMP_OK;
+	}
+
+	SMBIOSDUMP_API const char* smbiosdump_get_string(const smbiosdump_table* pTable, const std::size_t nIndex, const std::uint8_t nNumber, std::size_t* pnLength)
+	{
+		const SMBIOS::StructureHeader_t* pStructure = GetStructure(pTable, nIndex);
+		if (pStructure == nullptr)
+			return nullptr;
+
+		CStringSet strings(pStructure, pTable->pTableData + pTable->vecBoundaries[nIndex + 1U]);
+		const COutput::String_t string = strings.Get(nNumber);
+		if (pnLength != nullptr)
+			*pnLength = string.nLength;
+
+		return string.szValue;
+	}
+
+	SMBIOSDUMP_API std::int32_t smbiosdump_get_field(smbiosdump_table* pTable, const std::size_t nIndex, const char* szId, smbiosdump_value* pValue, char* pBuffer, const std::size_t nBufferSize)
+	{
+		const SMBIOS::StructureHeader_t* pStructure = GetStructure(pTable, nIndex);
+		if (pStructure == nullptr || szId == nullptr || pValue == nullptr || (pBuffer == nullptr && nBufferSize > 0U))
+			return SMBIOSDUMP_ERROR_ARGUMENT;
+
+		CFieldFinder fieldFinder(szId);
+		VisitStructure(fieldFinder, pTable->decodeState, pStructure, pTable->pTableData + pTable->vecBoundaries[nIndex + 1U], pTable->uVersion);
+
+		const DecodedValue_t* pFoundValue = fieldFinder.GetValue();
+		if (pFoundValue == nullptr)
+			return SMBIOSDUMP_ERROR_NOT_FOUND;
+
+		pValue->kind = pFoundValue->nKind;
+		pValue->integer = pFoundValue->ullInteger;
+		pValue->real = pFoundValue->dReal;
+		pValue->unit = pFoundValue->szUnit;
+		pValue->bytes = pFoundValue->pBytes;
+		pValue->byte_count = pFoundValue->nByteCount;
+		pValue->string = nullptr;
+		pValue->string_length = pFoundValue->nStringLength;
+
+		// enumeration without the name has no string, the same as the values of other kinds
+		if ((pFoundValue->nKind != VALUE_KIND_STRING && pFoundValue->nKind != VALUE_KIND_ENUM) || pFoundValue->pString == nullptr)
+			return SMBIOSDUMP_OK;
+
+		// the string and its terminator must fit, otherwise as much of it as fits is copied
+		const bool bTruncated = (pFoundValue->nStringLength >= nBufferSize);
+		if (nBufferSize == 0U)
+			return SMBIOSDUMP_ERROR_TRUNCATED;
+
+		// the string of the finder lives only as long as it does
+		const std::size_t nCopySize = (bTruncated ? nBufferSize - 1U : pFoundValue->nStringLength);
+		std::memcpy(pBuffer, pFoundValue->pString, nCopySize);
+		pBuffer[nCopySize] = '\0';
+		pValue->string = pBuffer;
+		return bTruncated ? SMBIOSDUMP_ERROR_TRUNCATED : SMBIOSDUMP_OK;
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+/*
+ * C interface of the decoding library, that is exported by the 'smbiosdump' shared library for the collectors written in other languages
+ * @remarks: interface is versioned, incompatible changes increment 'SMBIOSDUMP_ABI_VERSION' and the shared library version.
+ * structures, strings and raw bytes are returned as views into the table, that are valid until the table is closed, decoded values are copied to the caller buffer.
+ * table may be used by a single thread at a time, separate tables may be used by separate threads
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(SMBIOSDUMP_BUILD)
+#define SMBIOSDUMP_API __declspec(dllexport)
+#else
+#define SMBIOSDUMP_API __declspec(dllimport)
+#endif
+#else
+#define SMBIOSDUMP_API __attribute__((visibility("default")))
+#endif
+
+#define SMBIOSDUMP_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+	SMBIOSDUMP_OK = 0,
+	// argument is null or index is out of range
+	SMBIOSDUMP_ERROR_ARGUMENT = -1,
+	// file or tables of the current machine can't be read
+	SMBIOSDUMP_ERROR_INPUT = -2,
+	// entry point or dump is not valid
+	SMBIOSDUMP_ERROR_FORMAT = -3,
+	// structure doesn't have the requested field
+	SMBIOSDUMP_ERROR_NOT_FOUND = -4,
+	// string of the value doesn't fit the caller buffer, so it's truncated
+	SMBIOSDUMP_ERROR_TRUNCATED = -5,
+	SMBIOSDUMP_ERROR_MEMORY = -6
+};
+
+// kinds of the decoded values, in order of 'EValueKind'
+enum
+{
+	SMBIOSDUMP_VALUE_NULL = 0,
+	SMBIOSDUMP_VALUE_STRING,
+	SMBIOSDUMP_VALUE_UNSIGNED,
+	SMBIOSDUMP_VALUE_SIGNED,
+	SMBIOSDUMP_VALUE_REAL,
+	SMBIOSDUMP_VALUE_BOOLEAN,
+	SMBIOSDUMP_VALUE_ENUM,
+	SMBIOSDUMP_VALUE_HANDLE,
+	SMBIOSDUMP_VALUE_BYTES
+};
+
+typedef struct smbiosdump_table smbiosdump_table;
+
+// view of the single structure
+typedef struct smbiosdump_structure
+{
+	uint8_t type;
+	// length of the formatted area
+	uint8_t length;
+	uint16_t handle;
+	// structure header followed by the formatted area and the string-set
+	const uint8_t* data;
+	// size of the whole structure, including the string-set
+	size_t size;
+} smbiosdump_structure;
+
+// decoded field value
+typedef struct smbiosdump_value
+{
+	int32_t kind;
+	// unsigned or signed integer, boolean, code of the enumeration or handle
+	uint64_t integer;
+	double real;
+	// string or name of the enumeration, copied to the caller buffer and null-terminated, null for the values of other kinds, the enumeration without the name, or the empty caller buffer
+	const char* string;
+	// length of the whole string, that may exceed the caller buffer, zero if there is no string
+	size_t string_length;
+	// unit of the quantity, null if value has no unit
+	const char* unit;
+	// raw bytes of the structure
+	const uint8_t* bytes;
+	size_t byte_count;
+} smbiosdump_value;
+
+// @returns: 'SMBIOSDUMP_ABI_VERSION' of the loaded library
+SMBIOSDUMP_API uint32_t smbiosdump_abi_version(void);
+
+// open the dump of 'dmidecode --dump-bin' format from the buffer, that isn't copied and must outlive the table
+SMBIOSDUMP_API int32_t smbiosdump_open_buffer(const void* dump, size_t dump_size, smbiosdump_table** table);
+// open the dump of 'dmidecode --dump-bin' format from the file, that is mapped to memory
+SMBIOSDUMP_API int32_t smbiosdump_open_file(const char* path, smbiosdump_table** table);
+// open the tables of the current machine, from sysfs on linux
+SMBIOSDUMP_API int32_t smbiosdump_open_live(smbiosdump_table** table);
+SMBIOSDUMP_API void smbiosdump_close(smbiosdump_table* table);
+
+// @returns: SMBIOS version of the table, as 0x00MMmmrr
+SMBIOSDUMP_API uint32_t smbiosdump_table_version(const smbiosdump_table* table);
+// @returns: count of the complete structures of the table, including the end of table structure
+SMBIOSDUMP_API size_t smbiosdump_structure_count(const smbiosdump_table* table);
+SMBIOSDUMP_API int32_t smbiosdump_get_structure(const smbiosdump_table* table, size_t index, smbiosdump_structure* structure);
+/*
+ * get the string of the structure by its 1-based number, as referenced by the formatted area
+ * @returns: null-terminated string, null if the structure has no such string
+ */
+SMBIOSDUMP_API const char* smbiosdump_get_string(const smbiosdump_table* table, size_t index, uint8_t number, size_t* length);
+/*
+ * decode the field of the structure
+ * @param[in] id member name of the field in JSON output, e.g. "serial_number", the first field with this name is decoded, including the fields of groups and records
+ * @param[in] buffer caller buffer, that the string of the value is copied to
+ * @returns: 'SMBIOSDUMP_ERROR_TRUNCATED' if the string with its terminator doesn't fit the buffer, then the value is set as well
+ */
+SMBIOSDUMP_API int32_t smbiosdump_get_field(smbiosdump_table* table, size_t index, const char* id, smbiosdump_value* value, char* buffer, size_t buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <q-tee/smbios/smbios.h>
+
+#include "output.h"
+
+/*
+ * view of the string-set of the single structure, that locates its strings only when they're accessed
+ * @remarks: strings are located in order up to the requested one, once, and their lengths are kept, so they're not measured again when written
+ */
+class CStringSet
+{
+public:
+	/*
+	 * @param[in] pEnd byte past the double-null terminator of the string-set as found by the boundary scan, when null, the string-set must be terminated anyway
+	 */
+	explicit CStringSet(const SMBIOS::StructureHeader_t* pStructure, const std::uint8_t* pEnd = nullptr) :
+		pNext(reinterpret_cast<const char*>(pStructure) + pStructure->nLength), pLast(pEnd != nullptr ? reinterpret_cast<const char*>(pEnd) - 1 : nullptr) { }
+
+	CStringSet(const CStringSet&) = delete;
+	CStringSet& operator=(const CStringSet&) = delete;
+
+	// @returns: string of the given 1-based index, with null value if index is zero or exceeds the count of strings
+	[[nodiscard]] COutput::String_t Get(const std::size_t nIndex)
+	{
+		if (nIndex == 0U || nIndex > nMaxStringCount)
+			return { nullptr, 0U };
+
+		while (nLocatedCount < nIndex && !bLocatedAll)
+			LocateNext();
+
+		if (nIndex > nLocatedCount)
+			return { nullptr, 0U };
+
+		return arrStrings[nIndex - 1U];
+	}
+
+private:
+	// string index is a single byte, so there are at most 255 strings referenced
+	static constexpr std::size_t nMaxStringCount = 255U;
+
+	void LocateNext()
+	{
+		// the string-set is empty or all its strings are located, that is followed by the terminating null character
+		if (pNext == pLast || *pNext == '\0')
+		{
+			bLocatedAll = true;
+			return;
+		}
+
+		const char* pStringEnd = (pLast != nullptr ? static_cast<const char*>(std::memchr(pNext, '\0', static_cast<std::size_t>(pLast - pNext))) : pNext + std::strlen(pNext));
+		arrStrings[nLocatedCount++] = { pNext, static_cast<std::size_t>(pStringEnd - pNext) };
+		pNext = pStringEnd + 1;
+	}
+
+	// strings located so far, the rest is left uninitialized
+	COutput::String_t arrStrings[nMaxStringCount];
+	std::size_t nLocatedCount = 0U;
+	// beginning of the next string to locate
+	const char* pNext;
+	// terminating null character of the string-set, null if it's not known
+	const char* pLast;
+	bool bLocatedAll = false;
+};
@@ -0,0 +1,49 @@
+# run the executable with the cache directory over the sequence of dumps, and check that each run hits or misses the cache and outputs the expected text
+# usage: cmake -DEXECUTABLE=<path> -DFIXTURES=<dir> -DEXPECTED=<dir> -DCACHE=<dir> -P cache.cmake
+
+file(REMOVE_RECURSE "${CACHE}")
+
+# decode the dump with the cache, and check the lookup reported to stderr
+function(run_cached DUMP LOOKUP)
+	execute_process(COMMAND "${EXECUTABLE}" --dump ${DUMP}.bin --cache "${CACHE}" --cache-stats WORKING_DIRECTORY "${FIXTURES}" OUTPUT_VARIABLE OUTPUT ERROR_VARIABLE ERROR RESULT_VARIABLE RESULT)
+	if(NOT RESULT EQUAL 0)
+		message(FATAL_ERROR "${DUMP}: exited with ${RESULT}:\n${ERROR}")
+	endif()
+
+	if(NOT ERROR MATCHES "^\\[cache\\] ${LOOKUP}\n$")
+		message(FATAL_ERROR "${DUMP}: expected '${LOOKUP}', reported:\n${ERROR}")
+	endif()
+
+	file(READ "${EXPECTED}/${DUMP}.txt" EXPECTED_OUTPUT)
+	if(NOT OUTPUT STREQUAL EXPECTED_OUTPUT)
+		message(FATAL_ERROR "${DUMP}: output differs from the expected, after '${LOOKUP}'")
+	endif()
+endfunction()
+
+run_cached(server "miss, hits: 0, misses: 1")
+run_cached(server "hit, hits: 1, misses: 1")
+# changed table replaces the entry of the same options
+run_cached(random "miss, hits: 1, misses: 2")
+run_cached(random "hit, hits: 2, misses: 2")
+run_cached(server "miss, hits: 2, misses: 3")
+
+# corrupt entry fails its validation, so the table is decoded again and the entry is replaced
+file(GLOB ENTRIES "${CACHE}/*.cache")
+foreach(ENTRY ${ENTRIES})
+	file(WRITE "${ENTRY}" "corrupt")
+endforeach()
+run_cached(server "miss, hits: 2, misses: 4")
+run_cached(server "hit, hits: 3, misses: 4")
+
+# entries of the other build of the executable are never used, and don't replace the entries of this one
+get_filename_component(EXECUTABLE_NAME "${EXECUTABLE}" NAME)
+set(OTHER_EXECUTABLE "${CACHE}-build/${EXECUTABLE_NAME}")
+file(REMOVE_RECURSE "${CACHE}-build")
+file(COPY "${EXECUTABLE}" DESTINATION "${CACHE}-build")
+file(APPEND "${OTHER_EXECUTABLE}" "build")
+set(THIS_EXECUTABLE "${EXECUTABLE}")
+set(EXECUTABLE "${OTHER_EXECUTABLE}")
+run_cached(server "miss, hits: 3, misses: 5")
+run_cached(server "hit, hits: 4, misses: 5")
+set(EXECUTABLE "${THIS_EXECUTABLE}")
+run_cached(server "hit, hits: 5, misses: 5")
\ No newline at end of file
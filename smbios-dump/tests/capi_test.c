@@ -0,0 +1,120 @@
+/*
+ * consumer of the C interface of the 'smbiosdump' shared library, that is built as C to check the header as well
+ * @remarks: expects the server.bin fixture as its argument
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "smbiosdump.h"
+
+static int iResult = EXIT_SUCCESS;
+
+static void Check(const int bCondition, const int nLine, const char* szExpression)
+{
+	if (!bCondition)
+	{
+		printf("[error] check failed at line %d: %s\n", nLine, szExpression);
+		iResult = EXIT_FAILURE;
+	}
+}
+
+#define CHECK(EXPRESSION) Check((EXPRESSION), __LINE__, #EXPRESSION)
+
+// @returns: index of the first structure of the type, count of the structures if there is none
+static size_t FindStructure(const smbiosdump_table* pTable, const uint8_t uType)
+{
+	const size_t nStructureCount = smbiosdump_structure_count(pTable);
+	for (size_t i = 0U; i < nStructureCount; ++i)
+	{
+		smbiosdump_structure structure;
+		if (smbiosdump_get_structure(pTable, i, &structure) == SMBIOSDUMP_OK && structure.type == uType)
+			return i;
+	}
+
+	return nStructureCount;
+}
+
+int main(int nArgumentCount, char** arrArguments)
+{
+	if (nArgumentCount != 2)
+	{
+		printf("usage: %s <dump>\n", arrArguments[0]);
+		return EXIT_FAILURE;
+	}
+
+	CHECK(smbiosdump_abi_version() == SMBIOSDUMP_ABI_VERSION);
+
+	smbiosdump_table* pTable = NULL;
+	if (smbiosdump_open_file(arrArguments[1], &pTable) != SMBIOSDUMP_OK || pTable == NULL)
+	{
+		printf("[error] failed to open the dump: %s\n", arrArguments[1]);
+		return EXIT_FAILURE;
+	}
+
+	CHECK(smbiosdump_table_version(pTable) == 0x00030300U);
+
+	// iterate the structures, each of them is a view into the table
+	const size_t nStructureCount = smbiosdump_structure_count(pTable);
+	CHECK(nStructureCount > 0U);
+	for (size_t i = 0U; i < nStructureCount; ++i)
+	{
+		smbiosdump_structure structure;
+		CHECK(smbiosdump_get_structure(pTable, i, &structure) == SMBIOSDUMP_OK);
+		CHECK(structure.data != NULL && structure.size > structure.length && structure.data[0] == structure.type);
+	}
+
+	smbiosdump_structure structure;
+	CHECK(smbiosdump_get_structure(pTable, nStructureCount, &structure) == SMBIOSDUMP_ERROR_ARGUMENT);
+
+	const size_t nSystemIndex = FindStructure(pTable, 1U);
+	const size_t nMemoryDeviceIndex = FindStructure(pTable, 17U);
+	CHECK(nSystemIndex < nStructureCount && nMemoryDeviceIndex < nStructureCount);
+
+	// strings by their number, as referenced by the formatted area
+	size_t nStringLength = 0U;
+	const char* szManufacturer = smbiosdump_get_string(pTable, nSystemIndex, 1U, &nStringLength);
+	CHECK(szManufacturer != NULL && strcmp(szManufacturer, "Dell Inc.") == 0 && nStringLength == 9U);
+	CHECK(smbiosdump_get_string(pTable, nSystemIndex, 200U, &nStringLength) == NULL);
+
+	// fields by their member name, of each kind the fixture has
+	char arrBuffer[64];
+	smbiosdump_value value;
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "manufacturer", &value, arrBuffer, sizeof(arrBuffer)) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_STRING && value.string != NULL && strcmp(value.string, "Dell Inc.") == 0 && value.string_length == 9U);
+
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "wake_up_type", &value, arrBuffer, sizeof(arrBuffer)) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_ENUM && value.integer == 6U && value.string != NULL && strcmp(value.string, "Power Switch") == 0);
+
+	CHECK(smbiosdump_get_field(pTable, nMemoryDeviceIndex, "size", &value, arrBuffer, sizeof(arrBuffer)) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_UNSIGNED && value.integer == 16384U && value.unit != NULL && strcmp(value.unit, "MiB") == 0);
+
+	CHECK(smbiosdump_get_field(pTable, nMemoryDeviceIndex, "physical_memory_array_handle", &value, arrBuffer, sizeof(arrBuffer)) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_HANDLE && value.integer == 24U);
+
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "no_such_field", &value, arrBuffer, sizeof(arrBuffer)) == SMBIOSDUMP_ERROR_NOT_FOUND);
+
+	// string that doesn't fit the buffer is truncated, but its whole length is reported
+	char arrSmallBuffer[4];
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "manufacturer", &value, arrSmallBuffer, sizeof(arrSmallBuffer)) == SMBIOSDUMP_ERROR_TRUNCATED);
+	CHECK(value.string != NULL && strcmp(value.string, "Del") == 0 && value.string_length == 9U);
+
+	// string fits only together with its terminator
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "manufacturer", &value, arrBuffer, 10U) == SMBIOSDUMP_OK);
+	CHECK(value.string != NULL && strcmp(value.string, "Dell Inc.") == 0 && value.string_length == 9U);
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "manufacturer", &value, arrBuffer, 9U) == SMBIOSDUMP_ERROR_TRUNCATED);
+	CHECK(value.string != NULL && strcmp(value.string, "Dell Inc") == 0 && value.string_length == 9U);
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "wake_up_type", &value, arrBuffer, 13U) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_ENUM && value.string != NULL && strcmp(value.string, "Power Switch") == 0 && value.string_length == 12U);
+
+	// without the buffer only the length of the string is reported
+	CHECK(smbiosdump_get_field(pTable, nSystemIndex, "manufacturer", &value, NULL, 0U) == SMBIOSDUMP_ERROR_TRUNCATED);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_STRING && value.string == NULL && value.string_length == 9U);
+
+	// values of the other kinds don't need the buffer and have no string
+	CHECK(smbiosdump_get_field(pTable, nMemoryDeviceIndex, "physical_memory_array_handle", &value, NULL, 0U) == SMBIOSDUMP_OK);
+	CHECK(value.kind == SMBIOSDUMP_VALUE_HANDLE && value.string == NULL && value.string_length == 0U);
+
+	smbiosdump_close(pTable);
+	return iResult;
+}
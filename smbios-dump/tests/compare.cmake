@@ -0,0 +1,39 @@
+# run the executable and compare its standard output and exit code with the expected ones
+# usage: cmake -DEXECUTABLE=<path> -DARGUMENTS=<arguments> [-DEXPECTED=<file> | -DREFERENCE_ARGUMENTS=<arguments>] [-DEXIT_CODE=<code>] [-DERROR_CONTAINS=<text>] -DWORKING_DIRECTORY=<dir> -P compare.cmake
+# arguments are separated with spaces, so the fixtures are given relative to the working directory, expected output is either the file or the output of the same executable run with the reference arguments
+
+if(NOT DEFINED EXIT_CODE)
+	set(EXIT_CODE 0)
+endif()
+
+separate_arguments(ARGUMENTS UNIX_COMMAND "${ARGUMENTS}")
+execute_process(COMMAND "${EXECUTABLE}" ${ARGUMENTS} WORKING_DIRECTORY "${WORKING_DIRECTORY}" OUTPUT_VARIABLE OUTPUT ERROR_VARIABLE ERROR RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL EXIT_CODE)
+	message(FATAL_ERROR "exited with ${RESULT}, expected ${EXIT_CODE}:\n${OUTPUT}${ERROR}")
+endif()
+
+# standard error is passed through, unless it's checked to contain the expected text
+if(DEFINED ERROR_CONTAINS)
+	string(FIND "${ERROR}" "${ERROR_CONTAINS}" ERROR_POSITION)
+	if(ERROR_POSITION EQUAL -1)
+		message(FATAL_ERROR "standard error doesn't contain '${ERROR_CONTAINS}':\n${ERROR}")
+	endif()
+elseif(NOT ERROR STREQUAL "")
+	message("${ERROR}")
+endif()
+
+if(DEFINED EXPECTED)
+	file(READ "${EXPECTED}" EXPECTED_OUTPUT)
+else()
+	separate_arguments(REFERENCE_ARGUMENTS UNIX_COMMAND "${REFERENCE_ARGUMENTS}")
+	execute_process(COMMAND "${EXECUTABLE}" ${REFERENCE_ARGUMENTS} WORKING_DIRECTORY "${WORKING_DIRECTORY}" OUTPUT_VARIABLE EXPECTED_OUTPUT RESULT_VARIABLE RESULT)
+	if(NOT RESULT EQUAL EXIT_CODE)
+		message(FATAL_ERROR "reference exited with ${RESULT}, expected ${EXIT_CODE}:\n${EXPECTED_OUTPUT}")
+	endif()
+endif()
+
+if(NOT OUTPUT STREQUAL EXPECTED_OUTPUT)
+	# write the actual output to the working directory of the test, so it can be diffed with the expected one or accepted
+	file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/actual.txt" "${OUTPUT}")
+	message(FATAL_ERROR "output differs from the expected, actual output is written to: ${CMAKE_CURRENT_BINARY_DIR}/actual.txt")
+endif()
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "daemon.h"
+
+// SMBIOS version of the server.table fixture, that is given by its entry point
+constexpr std::uint32_t uFixtureVersion = 0x030300U;
+
+// request and its expected response, or the expected beginning of the long response
+struct Query_t
+{
+	const char* szRequest;
+	const char* szResponse;
+	bool bPrefix;
+	// count of the structures of the array response, zero if it isn't checked
+	std::size_t nStructureCount;
+};
+
+constexpr Query_t arrQuery[] =
+{
+	{ "handle 1", "{\"version\":\"3.3.0\",\"type\":1,\"name\":\"System Information\",\"handle\":1,\"length\":27,\"fields\":{\"manufacturer\":\"Dell Inc.\",\"product\":\"PowerEdge R740\",\"version\":\"1.0\",\"serial_number\":\"SN000000\",\"uuid\":\"8414D7C5-CFF8-F49B-6FB7-304790474B80\",\"wake_up_type\":{\"code\":6,\"name\":\"Power Switch\"},\"sku_number\":\"SKU=123\",\"family\":\"PowerEdge\"}}", false, 0U },
+	{ "type 4", "[{\"version\":\"3.3.0\",\"type\":4,", true, 3U },
+	{ "table", "[{\"version\":\"3.3.0\",\"type\":0,", true, 59U },
+	{ "field serial_number 1", "[{\"handle\":1,\"type\":1,\"value\":\"SN000000\"}]", false, 0U },
+	{ "field size 17", "[{\"handle\":26,\"type\":17,\"value\":{\"value\":16384,\"unit\":\"MiB\"}},{\"handle\":27,\"type\":17,\"value\":\"None\"},", true, 0U },
+	{ "field no_such_field", "[]", false, 0U },
+	{ "handle 999", "{\"error\":\"no structure with handle 0x03E7\"}", false, 0U },
+	{ "bogus", "{\"error\":\"invalid request, expected 'table', 'handle <handle>', 'type <type>' or 'field <name> [type]'\"}", false, 0U }
+};
+
+static bool ReadFile(const char* szFilePath, std::vector<std::uint8_t>& vecData)
+{
+	FILE* hFile = std::fopen(szFilePath, "rb");
+	if (hFile == nullptr)
+		return false;
+
+	std::uint8_t arrBuffer[4096];
+	std::size_t nReadSize = 0U;
+	while ((nReadSize = std::fread(arrBuffer, 1U, sizeof(arrBuffer), hFile)) > 0U)
+		vecData.insert(vecData.end(), arrBuffer, arrBuffer + nReadSize);
+
+	std::fclose(hFile);
+	return !vecData.empty();
+}
+
+// @returns: connected socket, or -1 if daemon doesn't accept the connections in time
+static int Connect(const char* szSocketPath)
+{
+	sockaddr_un address = { };
+	address.sun_family = AF_UNIX;
+	std::strncpy(address.sun_path, szSocketPath, sizeof(address.sun_path) - 1U);
+
+	// daemon is started by the other thread, so wait until it listens
+	for (int i = 0; i < 500; ++i)
+	{
+		const int iSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		if (::connect(iSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+			return iSocket;
+
+		::close(iSocket);
+		::usleep(10000);
+	}
+
+	return -1;
+}
+
+// @returns: true if the given count of response lines has been received, false if connection has been closed before
+static bool ReceiveLines(const int iSocket, const std::size_t nLineCount, std::vector<std::string>& vecLines)
+{
+	std::string strReceived;
+	char arrBuffer[4096];
+	while (vecLines.size() < nLineCount)
+	{
+		const ssize_t nReceived = ::recv(iSocket, arrBuffer, sizeof(arrBuffer), 0);
+		if (nReceived <= 0)
+			return false;
+
+		strReceived.append(arrBuffer, static_cast<std::size_t>(nReceived));
+
+		std::size_t nLineEnd = 0U;
+		while ((nLineEnd = strReceived.find('\n')) != std::string::npos)
+		{
+			vecLines.push_back(strReceived.substr(0U, nLineEnd));
+			strReceived.erase(0U, nLineEnd + 1U);
+		}
+	}
+
+	return vecLines.size() == nLineCount;
+}
+
+// @returns: true if the connection has been closed by the daemon after all of its responses, false if it's still open after the timeout
+static bool ReceiveUntilClosed(const int iSocket, std::string& strReceived)
+{
+	// daemon must close the connection right after it has answered, not when it's stopped
+	const timeval timeout = { 5, 0 };
+	::setsockopt(iSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	char arrBuffer[4096];
+	while (true)
+	{
+		const ssize_t nReceived = ::recv(iSocket, arrBuffer, sizeof(arrBuffer), 0);
+		if (nReceived == 0)
+			return true;
+
+		if (nReceived < 0)
+			return false;
+
+		strReceived.append(arrBuffer, static_cast<std::size_t>(nReceived));
+	}
+}
+
+// @returns: count of the structure documents of the array response
+static std::size_t CountStructures(const std::string& strResponse)
+{
+	std::size_t nCount = 0U;
+	for (std::size_t nPosition = 0U; (nPosition = strResponse.find("{\"version\":", nPosition)) != std::string::npos; ++nPosition)
+		++nCount;
+
+	return nCount;
+}
+
+int main(int nArgumentCount, char** arrArguments)
+{
+	if (nArgumentCount != 3)
+	{
+		std::printf("usage: %s <table> <socket>\n", arrArguments[0]);
+		return EXIT_FAILURE;
+	}
+
+	const char* szSocketPath = arrArguments[2];
+
+	std::vector<std::uint8_t> vecTableData;
+	if (!ReadFile(arrArguments[1], vecTableData))
+	{
+		std::printf("[error] failed to read table: %s\n", arrArguments[1]);
+		return EXIT_FAILURE;
+	}
+
+	DecodeState_t state;
+	CTableModel model;
+	if (!model.Build(state, DecodeOptions_t(), vecTableData.data(), vecTableData.size(), uFixtureVersion))
+	{
+		std::printf("[error] table is truncated\n");
+		return EXIT_FAILURE;
+	}
+
+	bool bDaemonStopped = false;
+	std::thread threadDaemon([&]()
+	{
+		bDaemonStopped = RunDaemon(szSocketPath, model);
+	});
+
+	int iResult = EXIT_SUCCESS;
+
+	// the same requests are pipelined over each of two connections, that are open at once
+	std::string strRequests;
+	for (const Query_t& query : arrQuery)
+		strRequests.append(query.szRequest).append("\n");
+
+	int arrSocket[2] = { Connect(szSocketPath), -1 };
+	arrSocket[1] = (arrSocket[0] >= 0 ? Connect(szSocketPath) : -1);
+	for (const int iSocket : arrSocket)
+	{
+		std::vector<std::string> vecLines;
+		if (iSocket < 0 || ::send(iSocket, strRequests.data(), strRequests.size(), 0) != static_cast<ssize_t>(strRequests.size()) || !ReceiveLines(iSocket, std::size(arrQuery), vecLines))
+		{
+			std::printf("[error] daemon hasn't answered the requests\n");
+			iResult = EXIT_FAILURE;
+			continue;
+		}
+
+		for (std::size_t i = 0U; i < std::size(arrQuery); ++i)
+		{
+			const Query_t& query = arrQuery[i];
+			const std::string& strResponse = vecLines[i];
+			const bool bMatches = (query.bPrefix ? strResponse.compare(0U, std::strlen(query.szResponse), query.szResponse) == 0 : strResponse == query.szResponse) && (query.nStructureCount == 0U || CountStructures(strResponse) == query.nStructureCount);
+			if (!bMatches)
+			{
+				std::printf("[error] request '%s' is answered with: %s\n", query.szRequest, strResponse.c_str());
+				iResult = EXIT_FAILURE;
+			}
+		}
+	}
+
+	// client that half-closes the connection after its request gets the end of the responses
+	if (const int iSocket = Connect(szSocketPath); iSocket >= 0)
+	{
+		std::string strReceived;
+		if (::send(iSocket, "handle 1\n", 9U, 0) != 9 || ::shutdown(iSocket, SHUT_WR) != 0 || !ReceiveUntilClosed(iSocket, strReceived) || strReceived != std::string(arrQuery[0].szResponse) + "\n")
+		{
+			std::printf("[error] half-closed connection hasn't been answered and closed: %s\n", strReceived.c_str());
+			iResult = EXIT_FAILURE;
+		}
+
+		::close(iSocket);
+	}
+
+	for (const int iSocket : arrSocket)
+	{
+		if (iSocket >= 0)
+			::close(iSocket);
+	}
+
+	// stop the daemon as the terminated process would
+	::pthread_kill(threadDaemon.native_handle(), SIGTERM);
+	threadDaemon.join();
+
+	if (!bDaemonStopped || ::access(szSocketPath, F_OK) == 0)
+	{
+		std::printf("[error] daemon hasn't been stopped cleanly\n");
+		iResult = EXIT_FAILURE;
+	}
+
+	return iResult;
+}
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "emitter.h"
+
+// count of the nested groups, that is more than the emitter accepts in either format
+constexpr std::size_t nGroupCount = 10U;
+
+// visitor that records the callbacks as the sequence of characters: '{' and '}' for the groups, 'f' for the fields
+class CRecordingVisitor : public IStructureVisitor
+{
+public:
+	void Field([[maybe_unused]] const char* szLabel, [[maybe_unused]] const DecodedValue_t& value) override
+	{
+		strCallbacks.push_back('f');
+	}
+
+	void BeginGroup([[maybe_unused]] const char* szLabel) override
+	{
+		strCallbacks.push_back('{');
+	}
+
+	void EndGroup() override
+	{
+		strCallbacks.push_back('}');
+	}
+
+	std::string strCallbacks;
+};
+
+// write the structure with the field in each of the nested groups, and the field after all of them
+static void EmitNestedGroups(CEmitter& emitter)
+{
+	alignas(SMBIOS::StructureHeader_t) const std::uint8_t arrStructure[] = { 1U, 4U, 0x10U, 0x00U };
+	emitter.BeginStructure(reinterpret_cast<const SMBIOS::StructureHeader_t*>(arrStructure), "Nested");
+
+	for (std::size_t i = 0U; i < nGroupCount; ++i)
+	{
+		emitter.BeginGroup("Group");
+		emitter.Field("Level", i);
+	}
+
+	for (std::size_t i = 0U; i < nGroupCount; ++i)
+		emitter.EndGroup();
+
+	emitter.Field("After", nGroupCount);
+	emitter.EndStructure();
+}
+
+int main()
+{
+	int iResult = EXIT_SUCCESS;
+
+	// groups nested deeper than the limit are written as null, and the document stays valid
+	COutput output;
+	CEmitter emitter(output, OUTPUT_FORMAT_NDJSON);
+	EmitNestedGroups(emitter);
+
+	const std::string strExpectedDocument = "{\"type\":1,\"name\":\"Nested\",\"handle\":16,\"length\":4,\"fields\":{\"group\":{\"level\":0,\"group\":{\"level\":1,\"group\":{\"level\":2,\"group\":{\"level\":3,\"group\":{\"level\":4,\"group\":{\"level\":5,\"group\":null}}}}}},\"after\":10}}\n";
+	if (const std::string strDocument(output.GetData(), output.GetSize()); strDocument != strExpectedDocument)
+	{
+		std::printf("[error] nested groups are written as: %s", strDocument.c_str());
+		iResult = EXIT_FAILURE;
+	}
+
+	// visitor is told about the rejected group, but not about anything inside it
+	COutput outputScratch;
+	CRecordingVisitor visitor;
+	CEmitter emitterVisitor(outputScratch, visitor);
+	EmitNestedGroups(emitterVisitor);
+
+	const std::string strExpectedCallbacks = "{f{f{f{f{f{f{f{f{}}}}}}}}}f";
+	if (visitor.strCallbacks != strExpectedCallbacks)
+	{
+		std::printf("[error] nested groups are visited as: %s\n", visitor.strCallbacks.c_str());
+		iResult = EXIT_FAILURE;
+	}
+
+	return iResult;
+}
@@ -0,0 +1,41 @@
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "cache.h"
+
+// seed of the seeded vectors, that is non-zero in each of its bytes
+constexpr std::uint64_t ullTestSeed = 0x9E3779B97F4A7C15ULL;
+
+// XXH64 known answers, that cover each tail of the input: empty, shorter than 4, 8 and 32 bytes, and the 32 bytes stripes
+constexpr struct { const char* szInput; std::uint64_t ullHash; std::uint64_t ullSeededHash; } arrHashVector[] =
+{
+	{ "", 0xEF46DB3751D8E999ULL, 0xC4349FC93C010000ULL },
+	{ "abc", 0x44BC2CF5AD770999ULL, 0x2ED0F59D6B43AC8BULL },
+	{ "abcdefg", 0x1860940E2902822DULL, 0x7C780398F88C92FAULL },
+	{ "Nobody inspects the spammish", 0x224C07E39D831376ULL, 0x330EC10CF7782B59ULL },
+	{ "Nobody inspects the spammish repetition", 0xFBCEA83C8A378BF1ULL, 0xEB8B157CA26CBF34ULL }
+};
+
+int main()
+{
+	int iResult = EXIT_SUCCESS;
+	for (const auto& hashVector : arrHashVector)
+	{
+		const std::size_t nInputSize = std::strlen(hashVector.szInput);
+		const std::uint64_t arrExpected[2] = { hashVector.ullHash, hashVector.ullSeededHash };
+		const std::uint64_t arrSeed[2] = { 0ULL, ullTestSeed };
+		for (std::size_t i = 0U; i < 2U; ++i)
+		{
+			const std::uint64_t ullHash = HashData(hashVector.szInput, nInputSize, arrSeed[i]);
+			if (ullHash != arrExpected[i])
+			{
+				std::printf("[error] hash of \"%s\" with seed 0x%016" PRIX64 " is 0x%016" PRIX64 ", expected 0x%016" PRIX64 "\n", hashVector.szInput, arrSeed[i], ullHash, arrExpected[i]);
+				iResult = EXIT_FAILURE;
+			}
+		}
+	}
+
+	return iResult;
+}
@@ -0,0 +1,25 @@
+# build the sysfs style tree from its listing, whose paths may have characters that not every file system the fixtures are checked out to allows, e.g. the colons of the PCI addresses
+# usage: cmake -DLISTING=<file> -DDIRECTORY=<dir> -P sysfs.cmake
+# each line of the listing is either "file <path> <content>" or "link <path> <target>", the paths are relative to the directory, that is recreated
+
+file(REMOVE_RECURSE "${DIRECTORY}")
+file(STRINGS "${LISTING}" ENTRIES)
+foreach(ENTRY ${ENTRIES})
+	if(NOT ENTRY MATCHES "^(file|link) ([^ ]+) (.*)$")
+		message(FATAL_ERROR "invalid listing entry: ${ENTRY}")
+	endif()
+
+	set(ENTRY_PATH "${DIRECTORY}/${CMAKE_MATCH_2}")
+	set(ENTRY_VALUE "${CMAKE_MATCH_3}")
+	get_filename_component(ENTRY_DIRECTORY "${ENTRY_PATH}" DIRECTORY)
+	file(MAKE_DIRECTORY "${ENTRY_DIRECTORY}")
+
+	if(CMAKE_MATCH_1 STREQUAL "file")
+		file(WRITE "${ENTRY_PATH}" "${ENTRY_VALUE}\n")
+	else()
+		execute_process(COMMAND "${CMAKE_COMMAND}" -E create_symlink "${ENTRY_VALUE}" "${ENTRY_PATH}" RESULT_VARIABLE RESULT)
+		if(NOT RESULT EQUAL 0)
+			message(FATAL_ERROR "failed to create link: ${ENTRY_PATH}")
+		endif()
+	endif()
+endforeach()
\ No newline at end of file
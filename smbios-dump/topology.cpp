@@ -0,0 +1,760 @@
+#include "topology.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <q-tee/common/common.h>
+#include <q-tee/smbios/smbios.h>
+
+#include "emitter.h"
+#include "resolver.h"
+#include "scanner.h"
+#include "stringset.h"
+
+#define SMB_FIELD_OFFSET(STRUCT, MEMBER) (sizeof(SMBIOS::StructureHeader_t) + Q_OFFSETOF(STRUCT, MEMBER))
+// offset right past the structure member, that must be covered by the structure length to be present
+#define SMB_FIELD_END(STRUCT, MEMBER) (SMB_FIELD_OFFSET(STRUCT, MEMBER) + sizeof(STRUCT::MEMBER))
+
+constexpr const char* arrChannelSource[] =
+{
+	"memory_channel",
+	"bank_locator",
+	"device_locator"
+};
+
+// @returns: offset right past the first occurrence of the given lower case word in the string, ignoring the case, zero if string doesn't contain it
+static std::size_t FindWord(const COutput::String_t string, const char* szWord)
+{
+	const std::size_t nWordLength = std::strlen(szWord);
+	for (std::size_t i = 0U; i + nWordLength <= string.nLength; ++i)
+	{
+		std::size_t j = 0U;
+		while (j < nWordLength && (string.szValue[i + j] | 0x20) == szWord[j])
+			++j;
+
+		if (j == nWordLength)
+			return i + nWordLength;
+	}
+
+	return 0U;
+}
+
+// @returns: true if character separates the words of the locator
+static bool IsLocatorSeparator(const char chValue)
+{
+	return chValue == '_' || chValue == '-' || chValue == ' ';
+}
+
+// @returns: size of the memory device in MiB, zero when the slot is empty or size is unknown
+static std::uint64_t GetMemoryDeviceSize(const SMBIOS::StructureHeader_t* pStructure, bool* pbPopulated)
+{
+	const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData);
+	*pbPopulated = false;
+	if (pStructure->nLength < SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, nFormFactor))
+		return 0U;
+
+	if (pMD->nSize == 0U && pMD->nSizeGranulatiry == 0U)
+		return 0U;
+
+	*pbPopulated = true;
+	if (pMD->nSize == 0x7FFF && pMD->nSizeGranulatiry == 1U)
+		return 0U;
+
+	// extended size is the bit-field, so it's present when the following field begins within the structure
+	if (pMD->nSize == 0x7FFF && pStructure->nLength >= SMB_FIELD_OFFSET(SMBIOS::MemoryDevice_t, uConfiguredSpeed))
+		return pMD->nSizeExtended;
+
+	// granularity is set when size is in kilobytes
+	return pMD->nSizeGranulatiry != 0U ? pMD->nSize / 1024U : pMD->nSize;
+}
+
+// @returns: configured speed of the memory device in MT/s, zero when it's unknown
+static std::uint32_t GetMemoryDeviceSpeed(const SMBIOS::StructureHeader_t* pStructure)
+{
+	const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData);
+	if (pStructure->nLength < SMB_FIELD_END(SMBIOS::MemoryDevice_t, uConfiguredSpeed))
+		return 0U;
+
+	if (pMD->uConfiguredSpeed == 0xFFFF)
+		return pStructure->nLength >= SMB_FIELD_END(SMBIOS::MemoryDevice_t, uConfiguredSpeedExtended) ? pMD->uConfiguredSpeedExtended & 0x7FFFFFFFU : 0U;
+
+	return pMD->uConfiguredSpeed;
+}
+
+// @returns: theoretical peak bandwidth in MB/s of the transfers of the given width in bits, zero when it's unknown
+static std::uint64_t GetBandwidth(const std::uint32_t uSpeed, const std::uint16_t nDataWidth)
+{
+	return static_cast<std::uint64_t>(uSpeed) * nDataWidth / 8U;
+}
+
+void CMemoryTopology::Build(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize)
+{
+	vecDevices.clear();
+	vecChannels.clear();
+	vecNodeMemoryMiB.clear();
+
+	std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	FindStructureBoundaries(pTableData, nTableSize, vecBoundaries);
+	const std::size_t nStructureCount = vecBoundaries.size() - 1U;
+
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType != SMBIOS::TYPE_MEMORY_DEVICE || pStructure->nLength < SMB_FIELD_END(SMBIOS::MemoryDevice_t, nBankLocator))
+			continue;
+
+		const auto pMD = reinterpret_cast<const SMBIOS::MemoryDevice_t*>(pStructure->arrData);
+		CStringSet strings(pStructure, pTableData + vecBoundaries[i + 1U]);
+
+		TopologyDevice_t device = { };
+		device.uHandle = pStructure->uHandle;
+		device.uArrayHandle = pMD->uPhysicalMemoryArrayHandle;
+		device.deviceLocator = strings.Get(pMD->nDeviceLocator);
+		device.bankLocator = strings.Get(pMD->nBankLocator);
+		device.ullSizeMiB = GetMemoryDeviceSize(pStructure, &device.bPopulated);
+		device.uSpeed = GetMemoryDeviceSpeed(pStructure);
+		device.nDataWidth = (pMD->nDataWidth != 0xFFFF ? pMD->nDataWidth : 0U);
+		device.nRank = (pStructure->nLength >= SMB_FIELD_END(SMBIOS::MemoryDevice_t, uAttributes) ? pMD->uRank : 0U);
+		device.nChannelIndex = ~0U;
+		device.iNode = -1;
+		vecDevices.push_back(device);
+	}
+
+	const auto fnAddChannel = [this](std::string strName, const EChannelSource nSource, const std::uint16_t uArrayHandle)
+	{
+		TopologyChannel_t channel = { };
+		channel.strName = std::move(strName);
+		channel.nSource = nSource;
+		channel.uArrayHandle = uArrayHandle;
+		channel.iNode = -1;
+		vecChannels.push_back(std::move(channel));
+		return static_cast<std::uint32_t>(vecChannels.size() - 1U);
+	};
+
+	// channels listed by the memory channel structures are reliable, so they're assigned first
+	for (std::size_t i = 0U; i < nStructureCount; ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType != SMBIOS::TYPE_MEMORY_CHANNEL || pStructure->nLength < SMB_FIELD_OFFSET(SMBIOS::MemoryChannel_t, arrDevices))
+			continue;
+
+		const auto pMC = reinterpret_cast<const SMBIOS::MemoryChannel_t*>(pStructure->arrData);
+		const std::size_t nDeviceCount = std::min<std::size_t>(pMC->nDeviceCount, (pStructure->nLength - SMB_FIELD_OFFSET(SMBIOS::MemoryChannel_t, arrDevices)) / sizeof(SMBIOS::MemoryChannelDevice_t));
+
+		char szName[32];
+		std::snprintf(szName, sizeof(szName), "Memory Channel 0x%04X", pStructure->uHandle);
+
+		const auto nChannelIndex = static_cast<std::uint32_t>(vecChannels.size());
+		for (std::size_t j = 0U; j < nDeviceCount; ++j)
+		{
+			for (std::uint32_t k = 0U; k < vecDevices.size(); ++k)
+			{
+				TopologyDevice_t& device = vecDevices[k];
+				if (device.uHandle != pMC->arrDevices[j].uHandle || device.nChannelIndex != ~0U)
+					continue;
+
+				if (nChannelIndex == vecChannels.size())
+					fnAddChannel(szName, CHANNEL_SOURCE_MEMORY_CHANNEL, device.uArrayHandle);
+
+				device.nChannelIndex = nChannelIndex;
+				vecChannels[nChannelIndex].vecDeviceIndices.push_back(k);
+			}
+		}
+	}
+
+	for (std::uint32_t i = 0U; i < vecDevices.size(); ++i)
+	{
+		TopologyDevice_t& device = vecDevices[i];
+		if (device.nChannelIndex != ~0U)
+			continue;
+
+		// bank locator names the channel on some boards, otherwise the slots of the same channel differ only by the trailing number of the device locator
+		EChannelSource nSource;
+		COutput::String_t name;
+		if (std::size_t nNameLength; device.bankLocator.szValue != nullptr && (nNameLength = FindWord(device.bankLocator, "channel")) != 0U)
+		{
+			// name ends with the channel identifier, dropping the slot that may follow it, e.g. 'P0_Node0_Channel1' of 'P0_Node0_Channel1_Dimm0'
+			while (nNameLength < device.bankLocator.nLength && IsLocatorSeparator(device.bankLocator.szValue[nNameLength]))
+				++nNameLength;
+			while (nNameLength < device.bankLocator.nLength && !IsLocatorSeparator(device.bankLocator.szValue[nNameLength]))
+				++nNameLength;
+
+			nSource = CHANNEL_SOURCE_BANK_LOCATOR;
+			name = { device.bankLocator.szValue, nNameLength };
+		}
+		else
+		{
+			nSource = CHANNEL_SOURCE_DEVICE_LOCATOR;
+			name = (device.deviceLocator.szValue != nullptr ? device.deviceLocator : COutput::String_t{ "Unknown", 7U });
+			while (name.nLength > 1U && name.szValue[name.nLength - 1U] >= '0' && name.szValue[name.nLength - 1U] <= '9')
+				--name.nLength;
+			while (name.nLength > 1U && IsLocatorSeparator(name.szValue[name.nLength - 1U]))
+				--name.nLength;
+		}
+
+		const auto itChannel = std::find_if(vecChannels.begin(), vecChannels.end(), [&](const TopologyChannel_t& channel)
+		{
+			return channel.nSource == nSource && channel.uArrayHandle == device.uArrayHandle && channel.strName.size() == name.nLength && std::memcmp(channel.strName.data(), name.szValue, name.nLength) == 0;
+		});
+
+		if (itChannel == vecChannels.end())
+			device.nChannelIndex = fnAddChannel(std::string(name.szValue, name.nLength), nSource, device.uArrayHandle);
+		else
+			device.nChannelIndex = static_cast<std::uint32_t>(itChannel - vecChannels.begin());
+
+		vecChannels[device.nChannelIndex].vecDeviceIndices.push_back(i);
+	}
+
+	SummarizeChannels();
+}
+
+std::size_t CMemoryTopology::JoinNodes(DecodeState_t& state, const std::uint8_t* pTableData, const std::size_t nTableSize, const std::vector<NodeMemoryRange_t>& vecNodeRanges)
+{
+	std::uint32_t nNodeCount = 0U;
+	for (const NodeMemoryRange_t& range : vecNodeRanges)
+		nNodeCount = std::max(nNodeCount, range.uNode + 1U);
+
+	vecNodeMemoryMiB.assign(nNodeCount, 0U);
+	for (const NodeMemoryRange_t& range : vecNodeRanges)
+		vecNodeMemoryMiB[range.uNode] += (range.ullEnd - range.ullBegin) >> 20U;
+
+	// resolver rebuilds the structure boundaries of the same table, so the strings referenced by the devices stay valid
+	CAddressResolver resolver;
+	resolver.Build(state, pTableData, nTableSize);
+
+	// memory array, that the memory array mapped address belongs to, for the addresses that aren't mapped to the devices
+	std::vector<std::pair<std::uint16_t, std::uint16_t>> vecArrayOfMapping;
+	const std::vector<std::uint32_t>& vecBoundaries = state.vecStructureBoundaries;
+	for (std::size_t i = 0U; i + 1U < vecBoundaries.size(); ++i)
+	{
+		const auto pStructure = reinterpret_cast<const SMBIOS::StructureHeader_t*>(pTableData + vecBoundaries[i]);
+		if (pStructure->nType == SMBIOS::TYPE_MEMORY_ARRAY_MAPPED_ADDRESS && pStructure->nLength >= SMB_FIELD_END(SMBIOS::MemoryArrayMappedAddress_t, uArrayHandle))
+			vecArrayOfMapping.emplace_back(pStructure->uHandle, reinterpret_cast<const SMBIOS::MemoryArrayMappedAddress_t*>(pStructure->arrData)->uArrayHandle);
+	}
+
+	// bytes of each node, that are mapped to each device
+	std::vector<std::uint64_t> vecDeviceNodeBytes(vecDevices.size() * nNodeCount, 0U);
+	const auto fnAddBytes = [&](const std::uint32_t nDeviceIndex, const std::uint32_t uNode, const std::uint64_t ullByteCount)
+	{
+		vecDeviceNodeBytes[nDeviceIndex * nNodeCount + uNode] += ullByteCount;
+	};
+
+	for (const NodeMemoryRange_t& range : vecNodeRanges)
+	{
+		resolver.ForEachSegment(range.ullBegin, range.ullEnd, [&](const MappedDevice_t* pDevices, const std::size_t nDeviceCount, const std::uint64_t ullOverlapSize)
+		{
+			// interleaved devices share the segment evenly
+			for (std::size_t i = 0U; i < nDeviceCount; ++i)
+			{
+				const MappedDevice_t& mappedDevice = pDevices[i];
+				if (mappedDevice.uDeviceHandle != 0xFFFF)
+				{
+					for (std::uint32_t j = 0U; j < vecDevices.size(); ++j)
+					{
+						if (vecDevices[j].uHandle == mappedDevice.uDeviceHandle)
+							fnAddBytes(j, range.uNode, ullOverlapSize / nDeviceCount);
+					}
+
+					continue;
+				}
+
+				// segment mapped only to the array is shared by all of its populated devices
+				const auto itMapping = std::find_if(vecArrayOfMapping.begin(), vecArrayOfMapping.end(), [&](const std::pair<std::uint16_t, std::uint16_t>& mapping)
+				{
+					return mapping.first == mappedDevice.uArrayMappedAddressHandle;
+				});
+				if (itMapping == vecArrayOfMapping.end())
+					continue;
+
+				for (std::uint32_t j = 0U; j < vecDevices.size(); ++j)
+				{
+					if (vecDevices[j].bPopulated && vecDevices[j].uArrayHandle == itMapping->second)
+						fnAddBytes(j, range.uNode, ullOverlapSize);
+				}
+			}
+		});
+	}
+
+	std::size_t nUnassignedCount = 0U;
+	for (std::uint32_t i = 0U; i < vecDevices.size(); ++i)
+	{
+		TopologyDevice_t& device = vecDevices[i];
+		device.iNode = -1;
+
+		std::uint64_t ullMaxByteCount = 0U;
+		for (std::uint32_t uNode = 0U; uNode < nNodeCount; ++uNode)
+		{
+			if (vecDeviceNodeBytes[i * nNodeCount + uNode] > ullMaxByteCount)
+			{
+				ullMaxByteCount = vecDeviceNodeBytes[i * nNodeCount + uNode];
+				device.iNode = static_cast<std::int32_t>(uNode);
+			}
+		}
+
+		if (device.bPopulated && device.iNode < 0)
+			++nUnassignedCount;
+	}
+
+	// empty slots have no addresses, so they're assigned to the node of the most of the mapped bytes of their array
+	for (TopologyDevice_t& device : vecDevices)
+	{
+		if (device.bPopulated)
+			continue;
+
+		std::uint64_t ullMaxByteCount = 0U;
+		for (std::uint32_t uNode = 0U; uNode < nNodeCount; ++uNode)
+		{
+			std::uint64_t ullByteCount = 0U;
+			for (std::uint32_t i = 0U; i < vecDevices.size(); ++i)
+			{
+				if (vecDevices[i].bPopulated && vecDevices[i].uArrayHandle == device.uArrayHandle)
+					ullByteCount += vecDeviceNodeBytes[i * nNodeCount + uNode];
+			}
+
+			if (ullByteCount > ullMaxByteCount)
+			{
+				ullMaxByteCount = ullByteCount;
+				device.iNode = static_cast<std::int32_t>(uNode);
+			}
+		}
+	}
+
+	SummarizeChannels();
+	return nUnassignedCount;
+}
+
+void CMemoryTopology::SummarizeChannels()
+{
+	std::vector<std::pair<std::int32_t, std::uint64_t>> vecNodeWeights;
+	for (TopologyChannel_t& channel : vecChannels)
+	{
+		channel.nPopulatedCount = 0U;
+		channel.ullCapacityMiB = 0U;
+		channel.uMinSpeed = channel.uMaxSpeed = 0U;
+		channel.nMinRank = channel.nMaxRank = 0U;
+		channel.nDataWidth = 0U;
+		channel.ullBandwidthMBs = 0U;
+
+		// node of the channel is the one of the most of its slots weighted by their size, as the channel derived from the locators may be shared between the sockets
+		vecNodeWeights.clear();
+		for (const std::uint32_t nDeviceIndex : channel.vecDeviceIndices)
+		{
+			const TopologyDevice_t& device = vecDevices[nDeviceIndex];
+			if (device.iNode < 0)
+				continue;
+
+			auto itWeight = std::find_if(vecNodeWeights.begin(), vecNodeWeights.end(), [&](const std::pair<std::int32_t, std::uint64_t>& weight)
+			{
+				return weight.first == device.iNode;
+			});
+			if (itWeight == vecNodeWeights.end())
+				itWeight = vecNodeWeights.insert(vecNodeWeights.end(), { device.iNode, 0U });
+
+			itWeight->second += device.ullSizeMiB + 1U;
+		}
+
+		channel.iNode = -1;
+		std::uint64_t ullMaxWeight = 0U;
+		for (const auto& [iNode, ullWeight] : vecNodeWeights)
+		{
+			if (ullWeight > ullMaxWeight)
+			{
+				channel.iNode = iNode;
+				ullMaxWeight = ullWeight;
+			}
+		}
+
+		for (const std::uint32_t nDeviceIndex : channel.vecDeviceIndices)
+		{
+			const TopologyDevice_t& device = vecDevices[nDeviceIndex];
+			if (!device.bPopulated)
+				continue;
+
+			++channel.nPopulatedCount;
+			channel.ullCapacityMiB += device.ullSizeMiB;
+
+			if (device.uSpeed != 0U)
+			{
+				channel.uMinSpeed = (channel.uMinSpeed == 0U ? device.uSpeed : std::min(channel.uMinSpeed, device.uSpeed));
+				channel.uMaxSpeed = std::max(channel.uMaxSpeed, device.uSpeed);
+			}
+
+			if (device.nRank != 0U)
+			{
+				channel.nMinRank = (channel.nMinRank == 0U ? device.nRank : std::min(channel.nMinRank, device.nRank));
+				channel.nMaxRank = std::max(channel.nMaxRank, device.nRank);
+			}
+
+			channel.nDataWidth = std::max(channel.nDataWidth, device.nDataWidth);
+		}
+
+		channel.ullBandwidthMBs = GetBandwidth(channel.uMinSpeed, channel.nDataWidth);
+	}
+}
+
+// scope of the balance, that is the node when it's known, or the memory array otherwise
+struct BalanceGroup_t
+{
+	std::int32_t iNode;
+	std::uint16_t uArrayHandle;
+	std::vector<std::uint32_t> vecChannelIndices;
+};
+
+// append the members of the scope of the finding, with the comma preceding them
+static void AppendScope(COutput& output, const BalanceGroup_t& group)
+{
+	if (group.iNode >= 0)
+		output.Print(",\"node\":", group.iNode, ",\"array_handle\":null");
+	else
+		output.Print(",\"node\":null,\"array_handle\":", group.uArrayHandle);
+}
+
+// append the finding of the values, that differ within the scope, unless they're all the same
+template <typename T>
+static void AppendMismatch(COutput& output, bool& bFirstFinding, const char* szKind, const BalanceGroup_t& group, const T minValue, const T maxValue)
+{
+	if (minValue == maxValue)
+		return;
+
+	output.Print(bFirstFinding ? "" : ",", "{\"kind\":\"", szKind, '"');
+	AppendScope(output, group);
+	output.Print(",\"min\":", minValue, ",\"max\":", maxValue, '}');
+	bFirstFinding = false;
+}
+
+// append the value, or null when it's unknown
+template <typename T>
+static void AppendKnown(COutput& output, const T value)
+{
+	if (value == 0U)
+		output.Append("null");
+	else
+		output.Append(value);
+}
+
+void CMemoryTopology::AppendReport(COutput& output) const
+{
+	std::uint64_t ullCapacityMiB = 0U;
+	std::size_t nPopulatedCount = 0U;
+	for (const TopologyDevice_t& device : vecDevices)
+	{
+		ullCapacityMiB += device.ullSizeMiB;
+		nPopulatedCount += device.bPopulated;
+	}
+
+	output.Print("{\"capacity_mib\":", ullCapacityMiB, ",\"slots\":", vecDevices.size(), ",\"populated_slots\":", nPopulatedCount, ",\"channels\":[");
+	for (std::size_t i = 0U; i < vecChannels.size(); ++i)
+	{
+		const TopologyChannel_t& channel = vecChannels[i];
+		output.Append(i > 0U ? ",{\"name\":" : "{\"name\":");
+		CEmitter::AppendString(output, { channel.strName.data(), channel.strName.size() });
+		output.Print(",\"source\":\"", arrChannelSource[channel.nSource], "\",\"array_handle\":", channel.uArrayHandle, ",\"node\":");
+		if (channel.iNode >= 0)
+			output.Append(channel.iNode);
+		else
+			output.Append("null");
+
+		output.Print(",\"slots\":", channel.vecDeviceIndices.size(), ",\"populated_slots\":", channel.nPopulatedCount, ",\"capacity_mib\":", channel.ullCapacityMiB, ",\"min_speed_mts\":");
+		AppendKnown(output, channel.uMinSpeed);
+		output.Append(",\"max_speed_mts\":");
+		AppendKnown(output, channel.uMaxSpeed);
+		output.Append(",\"min_rank\":");
+		AppendKnown(output, channel.nMinRank);
+		output.Append(",\"max_rank\":");
+		AppendKnown(output, channel.nMaxRank);
+		output.Append(",\"devices\":[");
+
+		for (std::size_t j = 0U; j < channel.vecDeviceIndices.size(); ++j)
+		{
+			const TopologyDevice_t& device = vecDevices[channel.vecDeviceIndices[j]];
+			output.Print(j > 0U ? ",{\"handle\":" : "{\"handle\":", device.uHandle, ",\"locator\":");
+			CEmitter::AppendString(output, device.deviceLocator);
+			output.Append(",\"bank_locator\":");
+			CEmitter::AppendString(output, device.bankLocator);
+			output.Print(",\"populated\":", device.bPopulated ? "true" : "false", ",\"size_mib\":", device.ullSizeMiB, ",\"speed_mts\":");
+			AppendKnown(output, device.uSpeed);
+			output.Append(",\"rank\":");
+			AppendKnown(output, device.nRank);
+			output.Append('}');
+		}
+		output.Append("]}");
+	}
+	output.Append("],\"nodes\":[");
+
+	// capacity installed in each node, next to the memory the system has in it
+	std::vector<std::uint64_t> vecNodeCapacityMiB(vecNodeMemoryMiB.size(), 0U);
+	for (const TopologyDevice_t& device : vecDevices)
+	{
+		if (device.iNode >= 0)
+			vecNodeCapacityMiB[device.iNode] += device.ullSizeMiB;
+	}
+
+	for (std::size_t uNode = 0U; uNode < vecNodeMemoryMiB.size(); ++uNode)
+	{
+		std::size_t nChannelCount = 0U, nPopulatedChannelCount = 0U;
+		for (const TopologyChannel_t& channel : vecChannels)
+		{
+			if (channel.iNode != static_cast<std::int32_t>(uNode))
+				continue;
+
+			++nChannelCount;
+			nPopulatedChannelCount += (channel.nPopulatedCount > 0U);
+		}
+
+		output.Print(uNode > 0U ? ",{\"node\":" : "{\"node\":", uNode, ",\"memory_mib\":", vecNodeMemoryMiB[uNode], ",\"capacity_mib\":", vecNodeCapacityMiB[uNode], ",\"channels\":", nChannelCount, ",\"populated_channels\":", nPopulatedChannelCount, '}');
+	}
+	output.Append("],\"findings\":[");
+
+	// channels are balanced within their node, empty slots of the unknown node are balanced within their array
+	std::vector<BalanceGroup_t> vecGroups;
+	for (std::uint32_t i = 0U; i < vecChannels.size(); ++i)
+	{
+		const TopologyChannel_t& channel = vecChannels[i];
+		auto itGroup = std::find_if(vecGroups.begin(), vecGroups.end(), [&](const BalanceGroup_t& group)
+		{
+			return group.iNode == channel.iNode && (channel.iNode >= 0 || group.uArrayHandle == channel.uArrayHandle);
+		});
+
+		if (itGroup == vecGroups.end())
+			itGroup = vecGroups.insert(vecGroups.end(), { channel.iNode, channel.uArrayHandle, { } });
+
+		itGroup->vecChannelIndices.push_back(i);
+	}
+
+	bool bFirstFinding = true;
+	for (const BalanceGroup_t& group : vecGroups)
+	{
+		std::uint32_t nMinDeviceCount = ~0U, nMaxDeviceCount = 0U;
+		std::uint64_t ullMinCapacity = ~0ULL, ullMaxCapacity = 0U;
+		std::uint32_t uMinSpeed = ~0U, uMaxSpeed = 0U;
+		std::uint8_t nMinRank = 0xFF, nMaxRank = 0U;
+		for (const std::uint32_t nChannelIndex : group.vecChannelIndices)
+		{
+			const TopologyChannel_t& channel = vecChannels[nChannelIndex];
+			if (channel.nPopulatedCount == 0U)
+				continue;
+
+			nMinDeviceCount = std::min(nMinDeviceCount, channel.nPopulatedCount);
+			nMaxDeviceCount = std::max(nMaxDeviceCount, channel.nPopulatedCount);
+			ullMinCapacity = std::min(ullMinCapacity, channel.ullCapacityMiB);
+			ullMaxCapacity = std::max(ullMaxCapacity, channel.ullCapacityMiB);
+
+			if (channel.uMaxSpeed != 0U)
+			{
+				uMinSpeed = std::min(uMinSpeed, channel.uMinSpeed);
+				uMaxSpeed = std::max(uMaxSpeed, channel.uMaxSpeed);
+			}
+
+			if (channel.nMaxRank != 0U)
+			{
+				nMinRank = std::min(nMinRank, channel.nMinRank);
+				nMaxRank = std::max(nMaxRank, channel.nMaxRank);
+			}
+		}
+
+		// group without any populated channel is not used at all, so there's nothing to balance
+		if (nMaxDeviceCount == 0U)
+			continue;
+
+		for (const std::uint32_t nChannelIndex : group.vecChannelIndices)
+		{
+			const TopologyChannel_t& channel = vecChannels[nChannelIndex];
+			if (channel.nPopulatedCount != 0U)
+				continue;
+
+			output.Print(bFirstFinding ? "" : ",", "{\"kind\":\"empty_channel\"");
+			AppendScope(output, group);
+			output.Append(",\"channel\":");
+			CEmitter::AppendString(output, { channel.strName.data(), channel.strName.size() });
+			output.Append('}');
+			bFirstFinding = false;
+		}
+
+		AppendMismatch(output, bFirstFinding, "device_count_mismatch", group, nMinDeviceCount, nMaxDeviceCount);
+		AppendMismatch(output, bFirstFinding, "capacity_mismatch", group, ullMinCapacity, ullMaxCapacity);
+		if (uMaxSpeed != 0U)
+			AppendMismatch(output, bFirstFinding, "speed_mismatch", group, uMinSpeed, uMaxSpeed);
+		if (nMaxRank != 0U)
+			AppendMismatch(output, bFirstFinding, "rank_mismatch", group, nMinRank, nMaxRank);
+	}
+
+	// nodes are compared by the capacity installed in them, as the memory the system has in each node is reduced by the firmware reservations
+	if (vecNodeCapacityMiB.size() > 1U)
+	{
+		const auto [itMinCapacity, itMaxCapacity] = std::minmax_element(vecNodeCapacityMiB.begin(), vecNodeCapacityMiB.end());
+		if (*itMinCapacity != *itMaxCapacity)
+		{
+			output.Print(bFirstFinding ? "" : ",", "{\"kind\":\"node_capacity_mismatch\",\"min\":", *itMinCapacity, ",\"max\":", *itMaxCapacity, '}');
+			bFirstFinding = false;
+		}
+	}
+
+	std::size_t nUnassignedCount = 0U;
+	for (const TopologyDevice_t& device : vecDevices)
+		nUnassignedCount += (device.bPopulated && device.iNode < 0);
+
+	if (!vecNodeMemoryMiB.empty() && nUnassignedCount > 0U)
+	{
+		output.Print(bFirstFinding ? "" : ",", "{\"kind\":\"unassigned_devices\",\"count\":", nUnassignedCount, '}');
+		bFirstFinding = false;
+	}
+
+	output.Print("],\"balanced\":", bFirstFinding ? "true" : "false", "}\n");
+}
+
+// append the bandwidth in MB/s with its value in GB/s, or 'Unknown' when it's unknown
+static void AppendBandwidthText(COutput& output, const std::uint64_t ullBandwidthMBs)
+{
+	if (ullBandwidthMBs == 0U)
+		output.Append("Unknown");
+	else
+		output.Print(ullBandwidthMBs, " MB/s (", COutput::Fixed(static_cast<double>(ullBandwidthMBs) / 1000.0, 1), " GB/s)");
+}
+
+void CMemoryTopology::AppendBandwidth(COutput& output, const EOutputFormat nFormat) const
+{
+	// arrays in order of their first channel
+	std::vector<std::uint16_t> vecArrayHandles;
+	std::uint64_t ullTotalBandwidthMBs = 0U;
+	for (const TopologyChannel_t& channel : vecChannels)
+	{
+		if (std::find(vecArrayHandles.begin(), vecArrayHandles.end(), channel.uArrayHandle) == vecArrayHandles.end())
+			vecArrayHandles.push_back(channel.uArrayHandle);
+
+		ullTotalBandwidthMBs += channel.ullBandwidthMBs;
+	}
+
+	// sums the bandwidth and counts the populated channels, that match the predicate
+	const auto fnSumChannels = [this](auto&& fnMatch, std::size_t* pnChannelCount, std::size_t* pnPopulatedCount)
+	{
+		std::uint64_t ullBandwidthMBs = 0U;
+		*pnChannelCount = *pnPopulatedCount = 0U;
+		for (const TopologyChannel_t& channel : vecChannels)
+		{
+			if (!fnMatch(channel))
+				continue;
+
+			++*pnChannelCount;
+			*pnPopulatedCount += (channel.nPopulatedCount > 0U);
+			ullBandwidthMBs += channel.ullBandwidthMBs;
+		}
+
+		return ullBandwidthMBs;
+	};
+
+	if (nFormat == OUTPUT_FORMAT_TEXT)
+	{
+		output.Append("Total Bandwidth: ");
+		AppendBandwidthText(output, ullTotalBandwidthMBs);
+		output.Append('\n');
+
+		for (const std::uint16_t uArrayHandle : vecArrayHandles)
+		{
+			std::size_t nChannelCount, nPopulatedCount;
+			const std::uint64_t ullBandwidthMBs = fnSumChannels([uArrayHandle](const TopologyChannel_t& channel) { return channel.uArrayHandle == uArrayHandle; }, &nChannelCount, &nPopulatedCount);
+
+			output.Print("\n[Memory Array 0x", COutput::Hex(uArrayHandle, 4), "]\nBandwidth: ");
+			AppendBandwidthText(output, ullBandwidthMBs);
+			output.Print("\nPopulated Channels: ", nPopulatedCount, " of ", nChannelCount, "\nChannels:\n");
+
+			for (const TopologyChannel_t& channel : vecChannels)
+			{
+				if (channel.uArrayHandle != uArrayHandle || channel.nPopulatedCount == 0U)
+					continue;
+
+				output.Print('\t', COutput::String_t{ channel.strName.data(), channel.strName.size() }, ": ");
+				AppendBandwidthText(output, channel.ullBandwidthMBs);
+				output.Append('\n');
+
+				for (const std::uint32_t nDeviceIndex : channel.vecDeviceIndices)
+				{
+					const TopologyDevice_t& device = vecDevices[nDeviceIndex];
+					if (!device.bPopulated)
+						continue;
+
+					output.Print("\t\t", device.deviceLocator.szValue != nullptr ? device.deviceLocator : COutput::String_t{ "Not Specified", 13U }, ": ");
+					const std::uint64_t ullBandwidthMBs = GetBandwidth(device.uSpeed, device.nDataWidth);
+					AppendBandwidthText(output, ullBandwidthMBs);
+					if (ullBandwidthMBs != 0U)
+						output.Print(", ", device.uSpeed, " MT/s, ", device.nDataWidth, " bits");
+
+					output.Append('\n');
+				}
+			}
+		}
+
+		for (std::size_t uNode = 0U; uNode < vecNodeMemoryMiB.size(); ++uNode)
+		{
+			std::size_t nChannelCount, nPopulatedCount;
+			const std::uint64_t ullBandwidthMBs = fnSumChannels([uNode](const TopologyChannel_t& channel) { return channel.iNode == static_cast<std::int32_t>(uNode); }, &nChannelCount, &nPopulatedCount);
+
+			output.Print("\n[Node ", uNode, "]\nBandwidth: ");
+			AppendBandwidthText(output, ullBandwidthMBs);
+			output.Print("\nPopulated Channels: ", nPopulatedCount, " of ", nChannelCount, '\n');
+		}
+
+		return;
+	}
+
+	// the document fits the single line, so it's the same for both JSON formats
+	output.Print("{\"bandwidth_mbs\":", ullTotalBandwidthMBs, ",\"arrays\":[");
+	for (std::size_t i = 0U; i < vecArrayHandles.size(); ++i)
+	{
+		const std::uint16_t uArrayHandle = vecArrayHandles[i];
+		std::size_t nChannelCount, nPopulatedCount;
+		const std::uint64_t ullBandwidthMBs = fnSumChannels([uArrayHandle](const TopologyChannel_t& channel) { return channel.uArrayHandle == uArrayHandle; }, &nChannelCount, &nPopulatedCount);
+		output.Print(i > 0U ? ",{\"array_handle\":" : "{\"array_handle\":", uArrayHandle, ",\"bandwidth_mbs\":", ullBandwidthMBs, ",\"channels\":", nChannelCount, ",\"populated_channels\":", nPopulatedCount, '}');
+	}
+	output.Append("],\"nodes\":[");
+
+	for (std::size_t uNode = 0U; uNode < vecNodeMemoryMiB.size(); ++uNode)
+	{
+		std::size_t nChannelCount, nPopulatedCount;
+		const std::uint64_t ullBandwidthMBs = fnSumChannels([uNode](const TopologyChannel_t& channel) { return channel.iNode == static_cast<std::int32_t>(uNode); }, &nChannelCount, &nPopulatedCount);
+		output.Print(uNode > 0U ? ",{\"node\":" : "{\"node\":", uNode, ",\"bandwidth_mbs\":", ullBandwidthMBs, ",\"channels\":", nChannelCount, ",\"populated_channels\":", nPopulatedCount, '}');
+	}
+	output.Append("],\"channels\":[");
+
+	for (std::size_t i = 0U; i < vecChannels.size(); ++i)
+	{
+		const TopologyChannel_t& channel = vecChannels[i];
+		output.Append(i > 0U ? ",{\"name\":" : "{\"name\":");
+		CEmitter::AppendString(output, { channel.strName.data(), channel.strName.size() });
+		output.Print(",\"array_handle\":", channel.uArrayHandle, ",\"node\":");
+		if (channel.iNode >= 0)
+			output.Append(channel.iNode);
+		else
+			output.Append("null");
+
+		output.Append(",\"speed_mts\":");
+		AppendKnown(output, channel.uMinSpeed);
+		output.Append(",\"data_width\":");
+		AppendKnown(output, channel.nDataWidth);
+		output.Append(",\"bandwidth_mbs\":");
+		AppendKnown(output, channel.ullBandwidthMBs);
+		output.Append(",\"devices\":[");
+
+		bool bFirstDevice = true;
+		for (const std::uint32_t nDeviceIndex : channel.vecDeviceIndices)
+		{
+			const TopologyDevice_t& device = vecDevices[nDeviceIndex];
+			if (!device.bPopulated)
+				continue;
+
+			output.Print(bFirstDevice ? "{\"handle\":" : ",{\"handle\":", device.uHandle, ",\"locator\":");
+			CEmitter::AppendString(output, device.deviceLocator);
+			output.Append(",\"speed_mts\":");
+			AppendKnown(output, device.uSpeed);
+			output.Append(",\"data_width\":");
+			AppendKnown(output, device.nDataWidth);
+			output.Append(",\"bandwidth_mbs\":");
+			AppendKnown(output, GetBandwidth(device.uSpeed, device.nDataWidth));
+			output.Append('}');
+			bFirstDevice = false;
+		}
+		output.Append("]}");
+	}
+	output.Append("]}\n");
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "decode.h"
+#include "emitter.h"
+#include "output.h"
+
+// range of the physical addresses in bytes, that belongs to the NUMA node, e.g. the memory block listed in '/sys/devices/system/node/node<N>'
+struct NodeMemoryRange_t
+{
+	std::uint32_t uNode;
+	std::uint64_t ullBegin;
+	// exclusive
+	std::uint64_t ullEnd;
+};
+
+// how the channel of the memory device has been determined, in order of reliability
+enum EChannelSource : std::uint8_t
+{
+	CHANNEL_SOURCE_MEMORY_CHANNEL = 0,
+	CHANNEL_SOURCE_BANK_LOCATOR,
+	CHANNEL_SOURCE_DEVICE_LOCATOR
+};
+
+// memory device slot, populated or empty
+struct TopologyDevice_t
+{
+	std::uint16_t uHandle;
+	std::uint16_t uArrayHandle;
+	// strings of the memory device, referencing the table, with null value when they're not specified
+	COutput::String_t deviceLocator;
+	COutput::String_t bankLocator;
+	// zero when the slot is empty or size is unknown
+	std::uint64_t ullSizeMiB;
+	bool bPopulated;
+	// configured speed in MT/s, zero when it's unknown
+	std::uint32_t uSpeed;
+	// in bits, without the error correction, zero when it's unknown
+	std::uint16_t nDataWidth;
+	// zero when it's unknown
+	std::uint8_t nRank;
+	std::uint32_t nChannelIndex;
+	// NUMA node, -1 when it's unknown
+	std::int32_t iNode;
+};
+
+// memory channel, that groups the device slots of the same array
+struct TopologyChannel_t
+{
+	std::string strName;
+	EChannelSource nSource;
+	std::uint16_t uArrayHandle;
+	// NUMA node of the most of the channel capacity, -1 when it's unknown
+	std::int32_t iNode;
+	std::vector<std::uint32_t> vecDeviceIndices;
+	std::uint32_t nPopulatedCount;
+	std::uint64_t ullCapacityMiB;
+	std::uint32_t uMinSpeed;
+	std::uint32_t uMaxSpeed;
+	std::uint8_t nMinRank;
+	std::uint8_t nMaxRank;
+	// widest data of the populated devices in bits, zero when it's unknown
+	std::uint16_t nDataWidth;
+	// theoretical peak in MB/s, as the devices of the channel share its bus at the speed of the slowest one, zero when it's unknown
+	std::uint64_t ullBandwidthMBs;
+};
+
+/*
+ * model of the memory population, that links the memory devices to their physical memory array, memory channel and NUMA node, to find the unbalanced population
+ * @remarks: channels are taken from the memory channel structures when they're present, otherwise they're derived from the locators, either the bank locator naming the channel, e.g. 'P0 CHANNEL A' or 'P0_Node0_Channel1_Dimm0',
+ * or the device locator without the trailing slot number, e.g. 'CPU0_DIMM_A' of 'CPU0_DIMM_A1'. nodes are known only when they're joined, the channels are balanced within their node, or within their array otherwise.
+ * model references the table strings, so the table must outlive it
+ */
+class CMemoryTopology
+{
+public:
+	// build the model of the given table, replacing the previous one
+	void Build(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize);
+	/*
+	 * assign the devices to the NUMA nodes by the physical address ranges of the nodes, through the mapped address structures of the table
+	 * @remarks: must be called after 'Build' with the same table, each device is assigned to the node of the most of its mapped bytes, and each empty slot to the one of its array
+	 * @returns: count of the populated devices, that haven't been assigned to any node
+	 */
+	std::size_t JoinNodes(DecodeState_t& state, const std::uint8_t* pTableData, std::size_t nTableSize, const std::vector<NodeMemoryRange_t>& vecNodeRanges);
+	// append the JSON document of the capacity, speed and rank per channel and per node, with the findings of the unbalanced population
+	void AppendReport(COutput& output) const;
+	/*
+	 * append the theoretical peak bandwidth of each device, channel, array and node, as the configured speed by the data width, either as the text or as the JSON document
+	 * @remarks: arrays usually stand for the sockets, nodes are reported only when they're joined. the peak is what the population allows, not the sustained bandwidth, that is lower
+	 */
+	void AppendBandwidth(COutput& output, EOutputFormat nFormat) const;
+
+	[[nodiscard]] const std::vector<TopologyDevice_t>& GetDevices() const
+	{
+		return vecDevices;
+	}
+
+	[[nodiscard]] const std::vector<TopologyChannel_t>& GetChannels() const
+	{
+		return vecChannels;
+	}
+
+private:
+	// update the per channel summaries from the devices
+	void SummarizeChannels();
+
+	std::vector<TopologyDevice_t> vecDevices;
+	std::vector<TopologyChannel_t> vecChannels;
+	// memory of each node, as given by its ranges in MiB, empty when nodes haven't been joined
+	std::vector<std::uint64_t> vecNodeMemoryMiB;
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <q-tee/smbios/smbios.h>
+
+enum EValueKind : std::uint8_t
+{
+	// string index, that doesn't reference any string of the structure
+	VALUE_KIND_NULL = 0,
+	VALUE_KIND_STRING,
+	VALUE_KIND_UNSIGNED,
+	// signed integer stored in the unsigned member in two's complement
+	VALUE_KIND_SIGNED,
+	VALUE_KIND_REAL,
+	VALUE_KIND_BOOLEAN,
+	// code of the enumeration with its name
+	VALUE_KIND_ENUM,
+	// handle of the referenced structure
+	VALUE_KIND_HANDLE,
+	VALUE_KIND_BYTES
+};
+
+/*
+ * typed value of the decoded field or list item
+ * @remarks: pointed data is valid only during the visitor callback, it must be copied to be kept
+ */
+struct DecodedValue_t
+{
+	EValueKind nKind = VALUE_KIND_NULL;
+	// unsigned or signed integer, boolean, code of the enumeration or handle
+	std::uint64_t ullInteger = 0ULL;
+	double dReal = 0.0;
+	// string or name of the enumeration, that isn't null-terminated
+	const char* pString = nullptr;
+	std::size_t nStringLength = 0U;
+	const std::uint8_t* pBytes = nullptr;
+	std::size_t nByteCount = 0U;
+	// unit of the quantity, null if value has no unit
+	const char* szUnit = nullptr;
+};
+
+/*
+ * receiver of the decoded tables, that gets the same fields as the text and JSON outputs, but with typed values instead of the formatted text
+ * @remarks: all callbacks do nothing by default, so only the interesting ones need to be overridden. labels are the text output labels, e.g. "Serial Number"
+ */
+class IStructureVisitor
+{
+public:
+	virtual ~IStructureVisitor() = default;
+
+	virtual void BeginTable([[maybe_unused]] std::uint32_t uVersion) { }
+	virtual void EndTable() { }
+	virtual void BeginStructure([[maybe_unused]] const SMBIOS::StructureHeader_t* pStructure, [[maybe_unused]] const char* szName) { }
+	virtual void EndStructure() { }
+	// field of the current structure, group or record
+	virtual void Field([[maybe_unused]] const char* szLabel, [[maybe_unused]] const DecodedValue_t& value) { }
+	// group of the fields, e.g. characteristics flags, closed by 'EndGroup'
+	virtual void BeginGroup([[maybe_unused]] const char* szLabel) { }
+	virtual void EndGroup() { }
+	// list of the items or records, closed by 'EndList'
+	virtual void BeginList([[maybe_unused]] const char* szLabel) { }
+	virtual void EndList() { }
+	virtual void Item([[maybe_unused]] const DecodedValue_t& value) { }
+	// record of the list, that consists of the fields, closed by 'EndRecord'
+	virtual void BeginRecord() { }
+	virtual void EndRecord() { }
+	virtual void Error([[maybe_unused]] const char* szMessage) { }
+};